@@ -0,0 +1,278 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Internet Checksum for NXP i.MX RT 105x Series
+ *               (used when EMAC_CHECKSUM_OFFLOAD is disabled)
+ * -------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0
+ *    Initial release
+ */
+
+/*
+  The data is summed as 32-bit words in memory byte order into a 64-bit
+  accumulator, which the compiler translates into ADDS/ADC instruction pairs
+  (the end-around carry is folded once at the end). The main loop is unrolled
+  to eight words for word aligned data; unaligned data is read with unaligned
+  word loads, which the Cortex-M7 supports in hardware. The one's complement
+  sum is independent of byte order (RFC 1071), the result is converted to host
+  byte order in EMAC_ChecksumFinal.
+*/
+
+#include "EMAC_Checksum_iMXRT105x.h"
+
+#include "fsl_common.h"
+
+/**
+  \fn          uint32_t EMAC_ChecksumAdd (const void *data, uint32_t len, uint32_t sum)
+  \brief       Add data to partial Internet checksum.
+  \param[in]   data  Pointer to data (any alignment)
+  \param[in]   len   Data length in bytes (must be even, except for the last block)
+  \param[in]   sum   Partial sum of preceding data (0 for the first block)
+  \return      partial sum
+*/
+uint32_t EMAC_ChecksumAdd (const void *data, uint32_t len, uint32_t sum) {
+  const uint8_t  *p = (const uint8_t *)data;
+  const uint32_t *w;
+  uint64_t acc = sum;
+
+  if (((uintptr_t)p & 3U) == 0U) {
+    /* Word aligned data */
+    w = (const uint32_t *)(const void *)p;
+    while (len >= 32U) {
+      acc += w[0]; acc += w[1]; acc += w[2]; acc += w[3];
+      acc += w[4]; acc += w[5]; acc += w[6]; acc += w[7];
+      w   += 8U;
+      len -= 32U;
+    }
+    while (len >= 4U) {
+      acc += *w++;
+      len -= 4U;
+    }
+    p = (const uint8_t *)w;
+  } else {
+    /* Unaligned data */
+    while (len >= 16U) {
+      acc += __UNALIGNED_UINT32_READ(&p[0]);
+      acc += __UNALIGNED_UINT32_READ(&p[4]);
+      acc += __UNALIGNED_UINT32_READ(&p[8]);
+      acc += __UNALIGNED_UINT32_READ(&p[12]);
+      p   += 16U;
+      len -= 16U;
+    }
+    while (len >= 4U) {
+      acc += __UNALIGNED_UINT32_READ(p);
+      p   += 4U;
+      len -= 4U;
+    }
+  }
+
+  if (len >= 2U) {
+    acc += (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    p   += 2U;
+    len -= 2U;
+  }
+  if (len != 0U) {
+    /* Odd byte is the most significant byte of a network order 16-bit word */
+    acc += p[0];
+  }
+
+  /* Fold end-around carries into 32 bits */
+  acc = (acc & 0xFFFFFFFFU) + (acc >> 32);
+  acc = (acc & 0xFFFFFFFFU) + (acc >> 32);
+
+  return ((uint32_t)acc);
+}
+
+/**
+  \fn          uint32_t EMAC_ChecksumPseudo (const uint8_t *src, const uint8_t *dst, uint32_t addr_len, uint8_t proto, uint32_t len)
+  \brief       Get partial sum of IPv4 or IPv6 pseudo header.
+  \param[in]   src       Pointer to source address
+  \param[in]   dst       Pointer to destination address
+  \param[in]   addr_len  Address length in bytes (4 = IPv4, 16 = IPv6)
+  \param[in]   proto     Protocol (next header)
+  \param[in]   len       Upper layer length in bytes
+  \return      partial sum
+*/
+uint32_t EMAC_ChecksumPseudo (const uint8_t *src, const uint8_t *dst, uint32_t addr_len, uint8_t proto, uint32_t len) {
+  uint64_t acc;
+
+  acc  = EMAC_ChecksumAdd (src, addr_len, 0U);
+  acc += EMAC_ChecksumAdd (dst, addr_len, 0U);
+
+  /* Protocol and length in network byte order, summed in memory byte order */
+  acc += (uint32_t)proto << 8;
+  acc += __REV (len);
+
+  acc = (acc & 0xFFFFFFFFU) + (acc >> 32);
+  acc = (acc & 0xFFFFFFFFU) + (acc >> 32);
+
+  return ((uint32_t)acc);
+}
+
+/**
+  \fn          uint16_t EMAC_ChecksumFinal (uint32_t sum)
+  \brief       Fold partial sum and get Internet checksum.
+  \param[in]   sum   Partial sum
+  \return      Internet checksum (one's complement of the folded sum)
+*/
+uint16_t EMAC_ChecksumFinal (uint32_t sum) {
+
+  sum = (sum & 0xFFFFU) + (sum >> 16);
+  sum = (sum & 0xFFFFU) + (sum >> 16);
+
+  /* Memory byte order to host byte order */
+  return ((uint16_t)~__REV16 (sum));
+}
+
+/**
+  \fn          uint16_t EMAC_Checksum (const void *data, uint32_t len)
+  \brief       Calculate Internet checksum of data block.
+  \param[in]   data  Pointer to data (any alignment)
+  \param[in]   len   Data length in bytes
+  \return      Internet checksum
+*/
+uint16_t EMAC_Checksum (const void *data, uint32_t len) {
+  return (EMAC_ChecksumFinal (EMAC_ChecksumAdd (data, len, 0U)));
+}
+
+/**
+  \fn          uint16_t EMAC_ChecksumUpdate16 (uint16_t csum, uint16_t old_val, uint16_t new_val)
+  \brief       Update Internet checksum for a changed 16-bit field (RFC 1624).
+  \param[in]   csum     Checksum before the change
+  \param[in]   old_val  Previous field value
+  \param[in]   new_val  New field value
+  \return      updated checksum
+*/
+uint16_t EMAC_ChecksumUpdate16 (uint16_t csum, uint16_t old_val, uint16_t new_val) {
+  uint32_t sum;
+
+  /* HC' = ~(~HC + ~m + m') */
+  sum  = (uint16_t)~csum;
+  sum += (uint16_t)~old_val;
+  sum += new_val;
+  sum  = (sum & 0xFFFFU) + (sum >> 16);
+  sum  = (sum & 0xFFFFU) + (sum >> 16);
+
+  return ((uint16_t)~sum);
+}
+
+/**
+  \fn          uint16_t EMAC_ChecksumUpdate32 (uint16_t csum, uint32_t old_val, uint32_t new_val)
+  \brief       Update Internet checksum for a changed 32-bit field (for example an IPv4 address).
+  \param[in]   csum     Checksum before the change
+  \param[in]   old_val  Previous field value
+  \param[in]   new_val  New field value
+  \return      updated checksum
+*/
+uint16_t EMAC_ChecksumUpdate32 (uint16_t csum, uint32_t old_val, uint32_t new_val) {
+
+  csum = EMAC_ChecksumUpdate16 (csum, (uint16_t)(old_val >> 16), (uint16_t)(new_val >> 16));
+  return (EMAC_ChecksumUpdate16 (csum, (uint16_t)old_val, (uint16_t)new_val));
+}
+
+/**
+  \fn          uint32_t EMAC_ChecksumVerifyFrame (const uint8_t *frame, uint32_t len)
+  \brief       Verify IPv4 header and TCP/UDP/ICMP checksums of received Ethernet frame.
+  \param[in]   frame  Pointer to Ethernet frame
+  \param[in]   len    Frame length in bytes
+  \return      1 = checksums valid or not checked, 0 = checksum error
+  \note        Checks the same fields as the ENET receive accelerator: IPv4 header checksum and
+               TCP, UDP and ICMP checksums of non-fragmented IPv4 and IPv6 datagrams.
+*/
+uint32_t EMAC_ChecksumVerifyFrame (const uint8_t *frame, uint32_t len) {
+  const uint8_t *ip;
+  uint32_t type, hlen, plen, proto, sum;
+
+  if (len < 14U) {
+    return (1U);
+  }
+  type = ((uint32_t)frame[12] << 8) | frame[13];
+  ip   = &frame[14];
+  len -= 14U;
+  if ((type == 0x8100U) && (len >= 4U)) {
+    /* VLAN tagged frame */
+    type = ((uint32_t)frame[16] << 8) | frame[17];
+    ip   = &frame[18];
+    len -= 4U;
+  }
+
+  if (type == 0x0800U) {
+    /* IPv4 */
+    if ((len < 20U) || ((ip[0] >> 4) != 4U)) {
+      return (1U);
+    }
+    hlen = (ip[0] & 0x0FU) * 4U;
+    if ((hlen < 20U) || (hlen > len)) {
+      return (1U);
+    }
+    if (EMAC_Checksum (ip, hlen) != 0U) {
+      /* Header checksum error */
+      return (0U);
+    }
+    plen = ((uint32_t)ip[2] << 8) | ip[3];
+    if ((plen < hlen) || (plen > len) || ((ip[6] & 0x3FU) != 0U) || (ip[7] != 0U)) {
+      /* Invalid length or fragment, protocol checksum not checked */
+      return (1U);
+    }
+    plen -= hlen;
+    proto = ip[9];
+    switch (proto) {
+      case 1U:
+        /* ICMP: no pseudo header */
+        sum = 0U;
+        break;
+      case 17U:
+        if ((plen >= 8U) && (ip[hlen + 6U] == 0U) && (ip[hlen + 7U] == 0U)) {
+          /* UDP checksum not used */
+          return (1U);
+        }
+        sum = EMAC_ChecksumPseudo (&ip[12], &ip[16], 4U, (uint8_t)proto, plen);
+        break;
+      case 6U:
+        sum = EMAC_ChecksumPseudo (&ip[12], &ip[16], 4U, (uint8_t)proto, plen);
+        break;
+      default:
+        return (1U);
+    }
+    ip += hlen;
+  }
+  else if (type == 0x86DDU) {
+    /* IPv6, upper layer header directly following the fixed header */
+    if ((len < 40U) || ((ip[0] >> 4) != 6U)) {
+      return (1U);
+    }
+    plen  = ((uint32_t)ip[4] << 8) | ip[5];
+    proto = ip[6];
+    if ((plen > (len - 40U)) || ((proto != 6U) && (proto != 17U) && (proto != 58U))) {
+      return (1U);
+    }
+    sum = EMAC_ChecksumPseudo (&ip[8], &ip[24], 16U, (uint8_t)proto, plen);
+    ip += 40U;
+  }
+  else {
+    return (1U);
+  }
+
+  return ((EMAC_ChecksumFinal (EMAC_ChecksumAdd (ip, plen, sum)) == 0U) ? 1U : 0U);
+}
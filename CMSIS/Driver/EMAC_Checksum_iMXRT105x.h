@@ -0,0 +1,105 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Internet Checksum Definitions for NXP iMXRT1050
+ * -------------------------------------------------------------------------- */
+
+#ifndef EMAC_CHECKSUM_IMXRT105x_H__
+#define EMAC_CHECKSUM_IMXRT105x_H__
+
+#include <stdint.h>
+
+/*
+  Partial sums (uint32_t) are accumulated in memory byte order and can be
+  combined with EMAC_ChecksumAdd. Checksums (uint16_t) are in host byte order,
+  store them most significant byte first into the frame.
+*/
+
+/**
+  \fn          uint32_t EMAC_ChecksumAdd (const void *data, uint32_t len, uint32_t sum)
+  \brief       Add data to partial Internet checksum.
+  \param[in]   data  Pointer to data (any alignment)
+  \param[in]   len   Data length in bytes (must be even, except for the last block)
+  \param[in]   sum   Partial sum of preceding data (0 for the first block)
+  \return      partial sum
+*/
+extern uint32_t EMAC_ChecksumAdd (const void *data, uint32_t len, uint32_t sum);
+
+/**
+  \fn          uint32_t EMAC_ChecksumPseudo (const uint8_t *src, const uint8_t *dst, uint32_t addr_len, uint8_t proto, uint32_t len)
+  \brief       Get partial sum of IPv4 or IPv6 pseudo header.
+  \param[in]   src       Pointer to source address
+  \param[in]   dst       Pointer to destination address
+  \param[in]   addr_len  Address length in bytes (4 = IPv4, 16 = IPv6)
+  \param[in]   proto     Protocol (next header)
+  \param[in]   len       Upper layer length in bytes
+  \return      partial sum
+*/
+extern uint32_t EMAC_ChecksumPseudo (const uint8_t *src, const uint8_t *dst, uint32_t addr_len, uint8_t proto, uint32_t len);
+
+/**
+  \fn          uint16_t EMAC_ChecksumFinal (uint32_t sum)
+  \brief       Fold partial sum and get Internet checksum.
+  \param[in]   sum   Partial sum
+  \return      Internet checksum (one's complement of the folded sum)
+*/
+extern uint16_t EMAC_ChecksumFinal (uint32_t sum);
+
+/**
+  \fn          uint16_t EMAC_Checksum (const void *data, uint32_t len)
+  \brief       Calculate Internet checksum of data block.
+  \param[in]   data  Pointer to data (any alignment)
+  \param[in]   len   Data length in bytes
+  \return      Internet checksum
+*/
+extern uint16_t EMAC_Checksum (const void *data, uint32_t len);
+
+/**
+  \fn          uint16_t EMAC_ChecksumUpdate16 (uint16_t csum, uint16_t old_val, uint16_t new_val)
+  \brief       Update Internet checksum for a changed 16-bit field (RFC 1624).
+  \param[in]   csum     Checksum before the change
+  \param[in]   old_val  Previous field value
+  \param[in]   new_val  New field value
+  \return      updated checksum
+*/
+extern uint16_t EMAC_ChecksumUpdate16 (uint16_t csum, uint16_t old_val, uint16_t new_val);
+
+/**
+  \fn          uint16_t EMAC_ChecksumUpdate32 (uint16_t csum, uint32_t old_val, uint32_t new_val)
+  \brief       Update Internet checksum for a changed 32-bit field (for example an IPv4 address).
+  \param[in]   csum     Checksum before the change
+  \param[in]   old_val  Previous field value
+  \param[in]   new_val  New field value
+  \return      updated checksum
+*/
+extern uint16_t EMAC_ChecksumUpdate32 (uint16_t csum, uint32_t old_val, uint32_t new_val);
+
+/**
+  \fn          uint32_t EMAC_ChecksumVerifyFrame (const uint8_t *frame, uint32_t len)
+  \brief       Verify IPv4 header and TCP/UDP/ICMP checksums of received Ethernet frame.
+  \param[in]   frame  Pointer to Ethernet frame
+  \param[in]   len    Frame length in bytes
+  \return      1 = checksums valid or not checked, 0 = checksum error
+*/
+extern uint32_t EMAC_ChecksumVerifyFrame (const uint8_t *frame, uint32_t len);
+
+#endif /* EMAC_CHECKSUM_IMXRT105x_H__ */
@@ -17,8 +17,8 @@
  * limitations under the License.
  *
  *
- * $Date:        4. October 2023
- * $Revision:    V1.6
+ * $Date:        16. October 2026
+ * $Revision:    V1.7
  *
  * Driver:       Driver_ETH_MAC0
  * Configured:   pin/clock configuration via MCUXpresso Config Tools
@@ -34,6 +34,31 @@
  * -------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.7
+ *    Added configurable frame buffer count and placement
+ *    Added zero-copy receive (EMAC_LoanRxFrame, EMAC_ReleaseRxFrame)
+ *    Added scatter-gather transmit of frame fragments (EMAC_TX_ZERO_COPY)
+ *    Removed intermediate transmit buffer (fragments are copied into the descriptor buffer)
+ *    Added software transmit queue with high/low watermark events (EMAC_TX_QUEUE_LEN)
+ *    Added batched receive of multiple frames (EMAC_ReadFrames)
+ *    Added interrupt coalescing control (EMAC_CONTROL_RX_COALESCE, EMAC_CONTROL_TX_COALESCE)
+ *    Added IEEE 1588 precision timer and frame timestamps (ENET_ENHANCEDBUFFERDESCRIPTOR_MODE)
+ *    Added VLAN filtering (exact VLAN tag and VLAN ID set)
+ *    Added exact-match multicast address filter with hit and false positive counters
+ *    Added interrupt driven MDIO transaction queue and PHY register cache
+ *    Control(ARM_ETH_MAC_CONFIGURE) updates MAC registers without ENET_Init
+ *    Added MIB/RMON and driver statistics with delta snapshots
+ *    Added adaptive interrupt/poll receive mode
+ *    Added small frame slab pool for zero-copy receive
+ *    Added receive IP header alignment (EMAC_RX_SHIFT16) and transmit FIFO watermark configuration
+ *    Added IEEE 802.3x flow control configuration
+ *    Added receive frame classification into priority classes
+ *    Added additional unicast addresses (individual address hash with exact match)
+ *    Added interrupt driven PHY link monitor (EMAC_PHY_INT_PIN)
+ *    Added software Internet checksum module and receive checksum verification (EMAC_RX_CHECKSUM_SW)
+ *    Added pcap frame capture ring buffer (EMAC_CAPTURE_SIZE)
+ *    Added optional event thread for callback delivery outside of interrupt (EMAC_EVENT_THREAD)
+ *    Added frame latency histograms (EMAC_LATENCY)
  *  Version 1.6
  *    Added volatile qualifier to volatile variables
  *  Version 1.5
@@ -101,6 +126,393 @@ the values that are shown in <em>italics</em>):
    to <em>25MHz</em>. Configure PLL6 (ENET_PLL) by setting PLL Power down to <em>No</em> and PLL6 bypass to <em>PLL6 (ENET)
    output</em>.
 -# Click on <b>Update Project</b> button to update source files
+
+<b>CMSIS-Driver for EMAC Interface Configuration</b>
+
+The following defines can be added to the project (for example to the compiler preprocessor settings) in order to
+change the default driver configuration:
+
+| Define                   | Default | Description                                                              |
+|:-------------------------|:--------|:-------------------------------------------------------------------------|
+| EMAC_CHECKSUM_OFFLOAD    | 1       | Receive/transmit checksum offload (0 = disabled, 1 = enabled)            |
+| EMAC_RX_CHECKSUM_SW      | 0       | Software receive checksum verification without offload (0/1)             |
+| EMAC_RX_BUF_CNT          | 4       | Number of receive buffer descriptors (each with a 1536 byte buffer)      |
+| EMAC_TX_BUF_CNT          | 2       | Number of transmit buffer descriptors (each with a 1536 byte buffer)     |
+| EMAC_BUF_SECTION         | -       | Linker section name for frame buffers (for example "DataQuickAccess")    |
+| EMAC_RX_SHIFT16          | 0       | Align IP header in receive buffers (0 = disabled, 1 = enabled)           |
+| EMAC_TX_FIFO_WATERMARK   | 0       | Transmit FIFO watermark in 64 byte units (0 = store and forward, 1..63)  |
+| EMAC_RX_LOAN_CNT         | 0       | Number of spare receive buffers for zero-copy receive (0 = disabled)     |
+| EMAC_RX_SLAB_CNT         | 0       | Number of small frame buffers filled at receive time (0 = disabled)      |
+| EMAC_RX_SLAB_SIZE        | 128     | Size of small frame buffer in bytes (multiple of 32)                     |
+| EMAC_RX_CLASS_CNT        | 0       | Number of receive priority classes (0 = disabled, 2..4)                  |
+| EMAC_RX_RULE_CNT         | 8       | Number of receive classification rules                                   |
+| EMAC_TX_ZERO_COPY        | 0       | Scatter-gather transmit without copying (0 = disabled, 1 = enabled)      |
+| EMAC_TX_QUEUE_LEN        | 0       | Number of frames in software transmit queue (0 = disabled)               |
+| EMAC_TX_QUEUE_HIGH       | 3/4     | Transmit queue high watermark (frames queued and in transmission)        |
+| EMAC_TX_QUEUE_LOW        | 1/4     | Transmit queue low watermark (frames queued and in transmission)         |
+| EMAC_PTP_CLOCK           | 0       | 1588 timer clock frequency in Hz (0 = ENET peripheral clock)             |
+| EMAC_PTP_ALARM           | 0       | Timer alarm, driver defines ENET_1588_Timer_IRQHandler (0/1)             |
+| EMAC_VLAN_SET            | 1       | VLAN ID set filter with 512 byte bitmap (0 = disabled, 1 = enabled)      |
+| EMAC_MCAST_CNT           | 16      | Number of entries in exact multicast address table (0 = disabled)        |
+| EMAC_UCAST_CNT           | 4       | Number of additional unicast addresses (0 = disabled)                    |
+| EMAC_MDIO_QUEUE_LEN      | 0/4     | Number of queued MDIO transactions (0 = polled, 4 with EMAC_PHY_INT_PIN) |
+| EMAC_PHY_CACHE_REGS      | 0x8000C | Bit mask of cached PHY registers (default: ID1, ID2, extended status)    |
+| EMAC_EVENT_THREAD        | 0       | Deliver events from a driver thread (0 = from interrupt, 1 = thread)     |
+| EMAC_EVENT_QUEUE_LEN     | 16      | Number of event records between interrupt and thread (power of 2)       |
+| EMAC_EVENT_THREAD_PRIO   | High    | CMSIS-RTOS2 priority of the event thread                                 |
+| EMAC_EVENT_THREAD_STACK  | 1024    | Stack size of the event thread in bytes                                  |
+| EMAC_MDIO_THREAD_FLAG    | 0x8000  | Thread flag on which PHY_Read/PHY_Write wait with EMAC_EVENT_THREAD      |
+| EMAC_STATS_PERIOD        | 0       | MIB counter accumulation period in ms (0 = only on statistics read)      |
+| EMAC_LATENCY             | 0       | Frame latency histograms (0 = disabled, 1 = enabled)                     |
+| EMAC_CAPTURE_SIZE        | 0       | Frame capture size in bytes, RX and TX rings (0 = disabled, power of 2)  |
+| EMAC_PHY_INT_PIN         | -       | GPIO pin of PHY interrupt line for link monitor (for example GPIO_PORT1(10)) |
+| EMAC_PHY_INT_REG         | 0x1B    | PHY interrupt control/status register (read clears the interrupt)       |
+| EMAC_PHY_INT_ENABLE      | 0x0500  | Value written to EMAC_PHY_INT_REG to enable link up/down interrupts     |
+
+Frame buffers are by default placed into the RW data region selected by the linker script. Define \b EMAC_BUF_SECTION
+to place them into a different memory (DTCM, OCRAM or SDRAM), for example <em>"DataQuickAccess"</em> to place them
+into the DTCM. Any other section name must be assigned to an execution region in the linker script.
+
+When \b EMAC_RX_SHIFT16 is enabled, the ENET inserts two bytes in front of each received frame so that the IP header
+following the 14 byte Ethernet header is 32-bit aligned. The driver skips the two bytes: \b ReadFrame copies and
+\b EMAC_LoanRxFrame returns the frame starting after them, so that the IP header of a loaned frame is word aligned.
+
+\b EMAC_TX_FIFO_WATERMARK selects when the ENET starts transmitting a frame: 0 (default with checksum offload)
+waits until the whole frame is in the transmit FIFO (store and forward), values from 1 to 63 start transmission
+after the given number of 64 byte blocks (cut-through), which reduces transmit latency. Transmit checksum
+offload requires store and forward mode and is not available in cut-through mode. With \b EMAC_CHECKSUM_OFFLOAD
+disabled the default watermark is 1 (64 bytes).
+
+<b>Software checksum</b>
+
+The module \b EMAC_Checksum_iMXRT105x.c provides optimized Internet checksum functions for the network stack when
+\b EMAC_CHECKSUM_OFFLOAD is disabled: \b EMAC_Checksum, \b EMAC_ChecksumAdd and \b EMAC_ChecksumPseudo calculate
+checksums with 32-bit word accumulation, and \b EMAC_ChecksumUpdate16 and \b EMAC_ChecksumUpdate32 update a
+checksum incrementally after a field has changed (RFC 1624). When \b EMAC_RX_CHECKSUM_SW is enabled, the driver
+reports receive checksum offload in the capabilities and, when enabled with \b ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX,
+verifies the IPv4 header and TCP/UDP/ICMP checksums of received frames in software like the ENET receive
+accelerator; frames with checksum errors are discarded (counted in \b rx_csum_drop). With receive classes
+(\b EMAC_RX_CLASS_CNT) the checksum is verified when the frame is read, not when the receive interrupt classifies
+it, so the interrupt handler does not touch the frame payload.
+
+The host test \b Test/EMAC_Checksum/EMAC_Checksum_Test.c checks the checksum functions against a byte-wise
+reference implementation and measures their throughput on the build host.
+
+<b>Zero-copy receive</b>
+
+When \b EMAC_RX_LOAN_CNT is greater than 0, the function \b EMAC_LoanRxFrame returns a pointer to the receive buffer
+of the next received frame instead of copying the frame. The receive descriptor is immediately re-armed with a buffer
+from the spare buffer pool. The loaned buffer must be returned with the function \b EMAC_ReleaseRxFrame. When all
+spare buffers are on loan, \b EMAC_LoanRxFrame returns \b ARM_DRIVER_ERROR_BUSY and the frame remains in the receive
+ring until a buffer is released.
+
+<b>Small frame slabs</b>
+
+Every receive descriptor owns a full \b EMAC_BUF_SIZE buffer, because the ENET selects the next descriptor
+regardless of the frame length. When \b EMAC_RX_SLAB_CNT is greater than 0, a few full-size buffers back a deep
+receive queue instead: the receive interrupt copies frames of up to \b EMAC_RX_SLAB_SIZE bytes (including the two
+byte alignment offset) from the ring head into small frame buffers of the slab pool and re-arms their descriptors at
+once, so that a burst of small frames does not exhaust the ring. Frames in slabs are read before the frames in the
+ring, in receive order: copying stops at the first larger frame and when the slab pool is exhausted. \b ReadFrame,
+\b EMAC_ReadFrames, \b EMAC_PollRx and \b GetRxFrameTime handle slab frames like ring frames; \b EMAC_LoanRxFrame
+loans the slab itself, which is returned with \b EMAC_ReleaseRxFrame. For example 8 descriptors and 64 slabs of
+128 bytes use 20 kB of receive buffers and hold 72 small frames, where a 64 descriptor ring uses 96 kB. The host test
+\b EMAC_RxBurst.c reports the receive buffer memory together with the drop rate of burst patterns.
+
+The slab pool has these limits:
+ - Large frames still need ring descriptors; a bulk transfer sees a ring of \b EMAC_RX_BUF_CNT descriptors.
+ - While a reader holds the ring head (after \b GetRxFrameSize returned the size of a ring frame, until the frame is
+   read), frames behind it are not copied.
+ - In polling mode (\b EMAC_CONTROL_RX_POLL) the receive interrupt is masked and no frames are copied, and with
+   interrupt coalescing the frame threshold must stay below \b EMAC_RX_BUF_CNT.
+ - The copy runs in the ENET interrupt (in the event thread with \b EMAC_EVENT_THREAD), up to
+   \b EMAC_RX_SLAB_SIZE bytes per small frame.
+ - Receive priority classes (\b EMAC_RX_CLASS_CNT) are not supported together with the slab pool.
+
+The host test \b Test/EMAC_Host/EMAC_LoanTest.c checks buffer ownership on the ENET model: loaned buffers are not
+in the receive ring and not written by the DMA, and a second release of the same buffer is rejected.
+
+<b>Receive priority classes</b>
+
+When \b EMAC_RX_CLASS_CNT is greater than 0, received frames are sorted into \b EMAC_RX_CLASS_CNT software queues
+by classification rules set with the function \b EMAC_SetRxRule. A rule (\b EMAC_RX_RULE) matches on any
+combination of ethertype, minimum VLAN priority (PCP) and destination MAC address; the first matching rule selects
+the class, frames which match no rule are placed into class 0. Classification is done in the receive interrupt,
+which signals \b ARM_ETH_MAC_EVENT_RX_FRAME together with \b EMAC_EVENT_RX_CLASS(n) for each class that received
+frames. \b ReadFrame, \b GetRxFrameSize and \b EMAC_LoanRxFrame drain the classes in strict priority order
+(highest class first); \b EMAC_ReadClassFrame reads from a single class. Receive descriptors are returned to the
+DMA in ring order. When a pending frame blocks the head of the ring while frames received after it were already
+read, the driver moves the pending frame (buffer and descriptor fields) into a consumed descriptor and returns the
+head descriptor to the DMA (counted in \b rx_class_move). A backlog of low priority frames therefore occupies only
+as many descriptors as frames are pending and does not stall the reception of high priority frames. Latency of the
+high priority class under bulk load can be measured with \b EMAC_LATENCY (receive read histogram). The host test
+\b EMAC_ClassLatency.c (see Host model) sends PTP frames between back to back bulk frames to a reader slower than
+the link: with a 32 descriptor ring the PTP frames wait 3.5 ms on average behind the bulk backlog without classes
+and 76 us (at most one bulk frame read) with two classes.
+
+<b>Scatter-gather transmit</b>
+
+By default, \b SendFrame copies the frame (or each frame fragment sent with \b ARM_ETH_MAC_TX_FRAME_FRAGMENT flag)
+into the buffer of the next free transmit descriptor. When \b EMAC_TX_ZERO_COPY is enabled, each fragment is mapped
+directly onto its own transmit descriptor and the frame is assembled by the DMA without copying. In this mode:
+  - frame data passed to \b SendFrame must remain valid and unchanged until the frame is transmitted
+    (signaled with \b ARM_ETH_MAC_EVENT_TX_FRAME event),
+  - a frame can consist of up to \b EMAC_TX_BUF_CNT fragments,
+  - when \b SendFrame returns \b ARM_DRIVER_ERROR_BUSY for a fragment, the fragments already accepted are retained
+    and the same fragment must be sent again.
+
+<b>Transmit queue</b>
+
+When \b EMAC_TX_QUEUE_LEN is greater than 0 (copy mode only), \b SendFrame places frames which do not find a free
+transmit descriptor into a software queue. Queued frames are handed to the DMA from the transmit interrupt, when
+transmitted descriptors are reclaimed. The driver signals \b EMAC_EVENT_TX_QUEUE_HIGH when the number of frames
+queued and in transmission reaches \b EMAC_TX_QUEUE_HIGH, and \b EMAC_EVENT_TX_QUEUE_LOW when it drops back to
+\b EMAC_TX_QUEUE_LOW. The network stack should stop sending between the two events; \b SendFrame returns
+\b ARM_DRIVER_ERROR_BUSY only when the queue is completely full.
+
+<b>Interrupt coalescing</b>
+
+By default, the ENET peripheral generates an interrupt for every received and transmitted frame. The following
+additional \b Control operations program the ENET interrupt coalescing registers, where \em arg is created with
+the macro \b EMAC_COALESCE_ARG(frames, usec):
+  - \b EMAC_CONTROL_RX_COALESCE: interrupt after \em frames received frames or \em usec microseconds after
+    the first frame (arg = 0 disables coalescing),
+  - \b EMAC_CONTROL_TX_COALESCE: same for transmitted frames,
+  - \b EMAC_CONTROL_RX_COALESCE_ADAPTIVE: adaptive receive coalescing where \em frames is the maximum frame
+    threshold and \em usec the interrupt delay. The driver starts with an interrupt per frame and enables
+    coalescing (threshold 2) when two receive interrupts are less than \em usec apart, measured with
+    \b EMAC_CYCLE_COUNT() (the DWT cycle counter is enabled by this call). The threshold is doubled when the number
+    of frames handled per interrupt reaches it and halved when it drops below half of it; when the delay expires
+    with a single frame, the driver returns to an interrupt per frame (arg = 0 disables adaptive mode).
+
+The host program \b Test/EMAC_Host/EMAC_IrqRate.c measures the receive interrupt rate and latency of each mode.
+
+<b>VLAN filtering</b>
+
+VLAN filtering is performed in the receive path: the VLAN tag of each received frame is checked in place in the
+receive buffer and frames that do not match are returned to the DMA without being copied. When a filter is active,
+only frames with IEEE 802.1Q tag (TPID 0x8100) and a matching VLAN tag are received. A frame is accepted when:
+  - its VLAN tag matches the tag set with \b ARM_ETH_MAC_VLAN_FILTER (the whole tag or only the VLAN ID when
+    \b ARM_ETH_MAC_VLAN_FILTER_ID_ONLY is specified; arg = 0 disables the exact filter), or
+  - its VLAN ID is in the VLAN ID set, maintained with the additional \b Control operations
+    \b EMAC_CONTROL_VLAN_ADD and \b EMAC_CONTROL_VLAN_REMOVE (arg = VLAN ID, 0..4095). The set is stored as a
+    bitmap and can be disabled with \b EMAC_VLAN_SET set to 0.
+
+<b>Multicast address filter</b>
+
+The ENET peripheral filters multicast frames with a 64-bit hash table, which also passes frames of multicast groups
+whose address hashes to the same bit. The driver therefore keeps a copy of the addresses configured with
+\b SetAddressFilter (up to \b EMAC_MCAST_CNT addresses) and discards the hash false positives in the receive path
+before the frame is copied. When more addresses are configured or in promiscuous mode only the hash filter is used.
+The function \b EMAC_GetMulticastStats returns the number of frames received for each configured address and the
+number of discarded false positive frames.
+
+<b>Additional unicast addresses</b>
+
+Besides the station address set with \b SetMacAddress, the driver can receive frames for up to \b EMAC_UCAST_CNT
+additional unicast addresses (for example a bridge port or service MAC) without enabling promiscuous mode. The
+function \b EMAC_SetUnicastFilter programs the ENET individual address hash table and keeps a copy of the addresses,
+which is used to discard the hash false positives in the receive path (counted in \b rx_ucast_drop). In
+promiscuous mode the software check is disabled.
+
+<b>MDIO transactions and PHY register cache</b>
+
+When \b EMAC_MDIO_QUEUE_LEN is greater than 0, PHY register accesses are queued and completed from the ENET MII
+interrupt. The queue is disabled by default and enabled with 4 entries when \b EMAC_PHY_INT_PIN is defined.
+
+\note With \b EMAC_MDIO_QUEUE_LEN greater than 0 the driver defines \b ENET_IRQHandler (a strong symbol that
+overrides the weak vector table entry), which handles the MII interrupt and forwards all other ENET interrupts to
+the SDK handler \b ENET_DriverIRQHandler. The application must not define its own \b ENET_IRQHandler in this
+configuration.
+
+The function \b EMAC_MDIO_Submit queues a transaction described by an \b EMAC_MDIO_XFER structure and returns
+immediately; the structure must remain valid until its status changes from \b EMAC_MDIO_PENDING and the optional
+callback function is called from the interrupt. A read of a cached register (see below) is the exception: it
+completes within \b EMAC_MDIO_Submit, which sets the status to \b EMAC_MDIO_DONE and calls the callback function
+from the calling context before it returns.
+
+\b PHY_Read and \b PHY_Write use the same queue and wait for completion of their transaction. With
+\b EMAC_EVENT_THREAD a calling thread blocks on the thread flag \b EMAC_MDIO_THREAD_FLAG, which the completion
+sets (the flag must not be used otherwise by threads that access the PHY), and the transaction is aborted after
+10 ms. Without an RTOS (\b EMAC_EVENT_THREAD is 0), and when called from an interrupt or with interrupts disabled,
+they are the legacy synchronous path: the caller polls the MII interrupt flag, for up to \b SystemCoreClock loop
+iterations, and disables interrupts only to complete a finished transaction the ENET interrupt did not take.
+
+Registers selected with \b EMAC_PHY_CACHE_REGS (PHY identifier and extended status registers by default) are
+cached after the first read from a PHY and subsequent reads from the same PHY complete without MDIO access.
+A write to a cached register updates the cache. Only registers that do not change at runtime should be cached.
+
+<b>Event thread</b>
+
+By default the driver calls the \b cb_event callback function from the ENET interrupt. When \b EMAC_EVENT_THREAD is
+enabled, the driver creates a CMSIS-RTOS2 thread in \b Initialize (the kernel must be initialized) and the ENET
+interrupt only posts a 32-bit event record into a lock-free ring of \b EMAC_EVENT_QUEUE_LEN entries and sets a thread
+flag. The ENET interrupt is the only producer and the thread the only consumer of the ring; events from other
+contexts (PHY link interrupt, 1588 timer interrupt, driver calls from threads) are merged into an event flag word
+with exclusive load/store. The thread drains all pending records, reclaims transmitted descriptors, sends queued
+frames, classifies received frames and calls \b cb_event once per batch with the combined event mask, so the
+network stack callback no longer runs in the interrupt. The descriptor work runs with only the ENET interrupt masked
+in the NVIC and the thread scheduler locked; other interrupts remain enabled. Records posted when the ring is full
+are merged into the next batch (counted in \b ev_overflow). The longest ENET interrupt callback is reported in
+\b isr_cycles (measured with \b EMAC_CYCLE_COUNT()).
+
+Besides posting the record, the ENET interrupt only counts interrupts, masks the receive interrupt in poll mode and
+records \b EMAC_CYCLE_COUNT() of the first receive and transmit interrupt not yet processed. Latency stamping, the
+ring full probe, adaptive coalescing and periodic statistics run in the event thread with the recorded time, so
+the latency of frames that complete later in the same batch is overestimated by at most the batch duration.
+
+<b>Latency histograms</b>
+
+When \b EMAC_LATENCY is enabled, the driver timestamps the receive interrupt, the completion of the frame read,
+the \b SendFrame entry and the transmit completed interrupt, and bins the intervals into log2 histograms of
+\b EMAC_LATENCY_BINS bins (bin n counts intervals from 2^n to 2^(n+1)-1 ticks) read with \b EMAC_GetLatency:
+ - \b EMAC_LATENCY_RX_READ: receive interrupt until the frame is read (time spent in the receive ring)
+ - \b EMAC_LATENCY_TX_SEND: \b SendFrame entry (first fragment) until the frame is handed over to DMA
+ - \b EMAC_LATENCY_TX_DONE: \b SendFrame entry (first fragment) until the transmit completed interrupt
+
+Frames received while the receive interrupt is masked (poll mode) are timestamped by the next receive interrupt.
+Timestamps are read with \b EMAC_CYCLE_COUNT(), which defaults to the DWT cycle counter. It can be defined to any
+free-running 32-bit counter, for example a wrapper around clock_gettime on a host build.
+
+<b>Frame capture</b>
+
+When \b EMAC_CAPTURE_SIZE is greater than 0, received and transmitted frames can be mirrored into a capture ring
+buffer in pcap record format. \b EMAC_CaptureStart enables the capture with a snap length (number of bytes stored
+per frame) and a sampling rate (every n-th frame is captured); \b EMAC_CaptureStop disables it. When the capture is
+disabled, the receive and transmit paths only test a flag. Received frames are captured when they are read by the
+network stack, transmitted frames when the last fragment is passed to \b SendFrame. The buffer is split into a
+receive and a transmit ring of \b EMAC_CAPTURE_SIZE / 2 bytes. Frames are read by \b ReadFrame, \b EMAC_ReadFrames,
+\b EMAC_ReadClassFrame, \b EMAC_PollRx and \b EMAC_LoanRxFrame, possibly from several threads, so each ring is
+claimed by one producer at a time: interrupts are disabled only to test and set the claim flag, the record is written
+with interrupts enabled. A frame read (or sent) while another thread writes a record into the same ring and frames
+which do not fit into their ring are counted in \b cap_drop. The rings are drained without locking by a single
+consumer, typically a low priority thread: it writes the 24 byte pcap file header returned by
+\b EMAC_CaptureHeader once and then appends the records read with \b EMAC_CaptureRead, which merges both rings in
+timestamp order, to a file or a network connection. Timestamps are taken from the weak function
+\b EMAC_CaptureTime, which returns the 1588 timer when available and can be overridden by the application. The host
+test \b EMAC_CaptureDump.c drains the rings into a .pcap file and checks it against the frames sent and received.
+
+<b>Host model</b>
+
+The directory \b Test/EMAC_Host builds the driver for a Linux host against a behavioural model of the ENET
+registers, the buffer descriptor DMA, interrupt coalescing, the MIB counters and the 1588 timer (ENET_Model.c),
+and against host replacements of the device header, fsl_enet and cmsis_os2. The host core (Host_Core.c) serializes
+driver contexts like a single Cortex-M core and runs the ENET interrupt on a separate thread. The benchmark
+\b EMAC_Bench.c injects frames at a configurable rate and size and reports frames/s, the drop rate and driver
+cycles per frame (host time scaled to \b SystemCoreClock, which compares driver variants but does not predict
+Cortex-M7 timing). \b EMAC_RxBurst.c measures in virtual time the receive drop rate of scripted burst patterns
+and the receive buffer memory for the ring depth \b EMAC_RX_BUF_CNT and slab pool it is built with.
+\b EMAC_TxBench.c compares the frame bytes per driver cycle of fragmented transmit with and without
+\b EMAC_TX_ZERO_COPY. \b EMAC_ClassLatency.c measures the receive latency of a high priority class under bulk
+load with and without \b EMAC_RX_CLASS_CNT. \b EMAC_CaptureDump.c drains the frame capture into a .pcap file.
+\b EMAC_Reconfig.c measures the driver cycles of \b Control(ARM_ETH_MAC_CONFIGURE) for each kind of change and
+checks which of the paths described under MAC reconfiguration is taken. The build commands are given at the top of
+each program.
+
+<b>PHY link monitor</b>
+
+When \b EMAC_PHY_INT_PIN is defined (requires the MDIO queue, enabled by default in this case), the function
+\b EMAC_LinkMonitor enables the PHY link interrupt and configures the PHY interrupt line with the GPIO driver
+(\b Driver_GPIO0, falling edge). On each interrupt the driver reads the PHY interrupt status register (which clears
+the interrupt), the basic status register and the auto-negotiation advertisement and link partner ability
+registers through the MDIO queue, without blocking. When the link state changes, the event
+\b EMAC_EVENT_LINK_CHANGE is signaled. \b EMAC_GetLinkState,
+called from thread context, returns the current link state and link information and sets the MAC speed and duplex
+mode to the negotiated values (the ENET peripheral is re-initialized when the MAC cannot be reconfigured on the fly);
+with \b EMAC_EVENT_THREAD this is done by the event thread before the event is signaled. A following
+\b Control(ARM_ETH_MAC_CONFIGURE) from the network stack overrides the negotiated values.
+The network stack does not need to poll the PHY periodically. The defaults of \b EMAC_PHY_INT_REG and
+\b EMAC_PHY_INT_ENABLE match the KSZ8081 PHY (interrupt control/status register 0x1B, link up and link down
+interrupts enabled).
+
+<b>MAC reconfiguration</b>
+
+\b Control(ARM_ETH_MAC_CONFIGURE) re-initializes the ENET peripheral only when the loopback mode is changed.
+Changes of promiscuous mode and broadcast reject are written to the receive control register on the fly. Changes of
+link speed, duplex mode and checksum offload stop the transmitter gracefully (the frame in progress completes, with
+interrupts enabled), then update the receive/transmit control and accelerator registers and restart the MAC with
+interrupts disabled only for the register and ring update. Transmit frames not yet sent are moved to the start of
+the ring and sent after the restart, loaned receive buffers are retained, frames received but not yet read are
+discarded. Receive and transmit remain enabled as they were before the call. When the graceful stop does not
+complete, the ENET peripheral is re-initialized instead.
+
+\b Control(ARM_ETH_MAC_FLUSH, ARM_ETH_MAC_FLUSH_TX) stops the transmitter and restarts the MAC the same way, but
+discards the transmit frames not yet sent: frames in the transmit descriptors and the transmit queue and fragments
+of a frame not yet complete. Frame data passed to \b SendFrame with \b EMAC_TX_ZERO_COPY is no longer referenced by
+the driver when the call returns. As with reconfiguration, frames received but not yet read are discarded.
+
+<b>Adaptive interrupt/poll receive</b>
+
+The additional \b Control operation \b EMAC_CONTROL_RX_POLL (arg = 1 enables, 0 disables) switches the receiver
+to adaptive interrupt/poll mode. The first receive interrupt masks the receive interrupt and signals
+\b ARM_ETH_MAC_EVENT_RX_FRAME once. The network stack then calls \b EMAC_PollRx with a frame budget until it returns
+fewer frames than the budget: at that point the receive ring is drained and the receive interrupt is enabled again.
+The \b rx_irq statistics counter can be compared to \b rx_frames to evaluate the interrupt load in both modes. The
+host benchmark \b EMAC_PollBench.c (see Host model) reports the receive interrupts, event signals and driver cycles
+per frame of both modes over the frame rate.
+
+<b>Statistics</b>
+
+The function \b EMAC_GetStatistics returns the ENET MIB (RMON and IEEE) counters together with driver counters
+(receive ring full, receive frames dropped due to errors or filtering, transmit busy and fragment copies) in an
+\b EMAC_STATS structure. Most ENET MIB frame counters are 16-bit wide and wrap after 400 ms at 100 Mbit/s with
+minimum size frames. The driver extends them to 32-bit totals each time the statistics are read.
+\b EMAC_GetStatisticsDelta returns the counter increments since the previous call with the same snapshot
+structure and updates the snapshot, which allows a monitoring thread to compute per-second rates without
+resetting the counters.
+
+Periodic accumulation is opt-in: when \b EMAC_STATS_PERIOD is not 0 (default 0), the driver also accumulates the
+counters from driver context once the period has elapsed: in the ENET interrupt, in \b EMAC_PollRx and in the event
+thread (which then wakes up at least once per period). The period is measured with \b EMAC_CYCLE_COUNT() in
+\b SystemCoreClock cycles; unless the application defines \b EMAC_CYCLE_COUNT, \b Initialize enables the DWT
+cycle counter for it. Each ENET interrupt (the event thread with \b EMAC_EVENT_THREAD) then reads the cycle
+counter once and compares it to the period.
+
+\note Counter increments are only seen when the driver accumulates them. With \b EMAC_STATS_PERIOD at 0 this
+happens only when the statistics are read, so the application must read them at least every 400 ms. With a period
+set, a 16-bit counter can still wrap unseen when, for 400 ms, neither the ENET interrupt, nor the event thread, nor
+\b EMAC_PollRx runs while the ENET counts frames, for example frames discarded by the address filter, which raise
+no receive interrupt. Only the event thread, which wakes up once per period, avoids this.
+
+<b>Flow control</b>
+
+The additional \b Control operation \b EMAC_CONTROL_FLOW_CONTROL enables symmetric IEEE 802.3x flow control, where
+\em arg is created with the macro \b EMAC_FLOW_CONTROL_ARG(quanta, empty, full) (arg = 0 disables flow control):
+  - \em quanta: pause duration in slot times (512 bit times) sent in XOFF pause frames,
+  - \em empty: receive FIFO section empty threshold in 64-bit words; when the receive FIFO fills up to this level,
+    an XOFF pause frame is sent, and an XON pause frame when it drains below it again,
+  - \em full: receive FIFO section full threshold in 64-bit words (0 = store and forward, required for receive
+    checksum offload).
+
+Pause frames received from the link partner stop the transmitter for the requested time. The number of pause
+frames sent and received is reported in the \b tx_pause and \b rx_pause statistics counters.
+
+<b>IEEE 1588 precision timer</b>
+
+The precision timer and receive/transmit frame timestamps are available when the SDK enhanced buffer descriptors
+are enabled with the global define \b ENET_ENHANCEDBUFFERDESCRIPTOR_MODE. The 1588 timer is clocked from the
+ENET peripheral (IPG) clock; fractional nanosecond increments are compensated with the timer correction logic.
+Timestamps are captured in nanoseconds by the DMA and extended with the seconds counter, therefore
+\b GetTxFrameTime and \b GetRxFrameTime must be called within one second after the frame was transmitted or
+received. The timer runs with an integer nominal increment per clock cycle; \b ARM_ETH_MAC_TIMER_ADJUST_CLOCK and a
+clock period which is not a whole number of nanoseconds are compensated by adding or removing nanoseconds every
+correction period. With the default 150 MHz IPG clock the nominal correction already removes one nanosecond every
+third cycle, which limits the steering resolution; define \b EMAC_PTP_CLOCK when the timer is clocked from a
+clock with an integer period (for example 25 MHz, 50 MHz or 125 MHz).
+
+Only one transmit timestamp can be pending: while the timestamp of a frame sent with
+\b ARM_ETH_MAC_TX_FRAME_TIMESTAMP has not been read with \b GetTxFrameTime, \b SendFrame returns
+\b ARM_DRIVER_ERROR_BUSY for the next frame (or first fragment) with this flag. Frames without the flag are not
+affected.
+
+The timer alarm (\b ARM_ETH_MAC_TIMER_SET_ALARM) is enabled with \b EMAC_PTP_ALARM set to 1 and returns
+\b ARM_DRIVER_ERROR_UNSUPPORTED otherwise. It uses 1588 timer compare channel 3, which is armed in the alarm second
+and signals the alarm from the 1588 timer interrupt.
+
+\note With \b EMAC_PTP_ALARM set to 1 the driver defines \b ENET_1588_Timer_IRQHandler (a strong symbol that
+overrides the weak vector table entry), which handles the compare channel and forwards all other 1588 timer
+interrupts to the SDK handler \b ENET_1588_Timer_DriverIRQHandler. The application must not define its own
+\b ENET_1588_Timer_IRQHandler in this configuration.
 */
 
 /*! \cond */
@@ -113,13 +525,297 @@ the values that are shown in <em>italics</em>):
   #define EMAC_CHECKSUM_OFFLOAD   1
 #endif
 
+/* Software receive checksum verification (checksum offload disabled) */
+#ifndef EMAC_RX_CHECKSUM_SW
+  #define EMAC_RX_CHECKSUM_SW     0
+#endif
+#if ((EMAC_RX_CHECKSUM_SW != 0) && (EMAC_CHECKSUM_OFFLOAD != 0))
+  #error "EMAC_RX_CHECKSUM_SW requires EMAC_CHECKSUM_OFFLOAD disabled"
+#endif
+#if (EMAC_RX_CHECKSUM_SW != 0)
+  #include "EMAC_Checksum_iMXRT105x.h"
+#endif
+
+/* Number of receive buffer descriptors */
+#ifndef EMAC_RX_BUF_CNT
+  #define EMAC_RX_BUF_CNT       4U      /* 0x1800 for Rx (4*1536=6K)          */
+#endif
+
+/* Number of transmit buffer descriptors */
+#ifndef EMAC_TX_BUF_CNT
+  #define EMAC_TX_BUF_CNT       2U      /* 0x0C00 for Tx (2*1536=3K)          */
+#endif
+
+/* Number of spare receive buffers for zero-copy receive (0 = disabled) */
+#ifndef EMAC_RX_LOAN_CNT
+  #define EMAC_RX_LOAN_CNT      0U
+#endif
+
+/* Scatter-gather transmit without copying disabled by default */
+#ifndef EMAC_TX_ZERO_COPY
+  #define EMAC_TX_ZERO_COPY     0
+#endif
+
+/* Number of frames in software transmit queue (0 = disabled) */
+#ifndef EMAC_TX_QUEUE_LEN
+  #define EMAC_TX_QUEUE_LEN     0U
+#endif
+
 
-#define ARM_ETH_MAC_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,6) /* driver version */
+#define ARM_ETH_MAC_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,7) /* driver version */
 
 /* EMAC Memory Buffer configuration */
 #define EMAC_BUF_SIZE           1536U   /* ETH Receive/Transmit buffer size   */
-#define EMAC_RX_BUF_CNT         4U      /* 0x1800 for Rx (4*1536=6K)          */
-#define EMAC_TX_BUF_CNT         2U      /* 0x0C00 for Tx (2*1536=3K)          */
+
+#if ((EMAC_RX_BUF_CNT < 2U) || (EMAC_RX_BUF_CNT > 1024U))
+  #error "EMAC_RX_BUF_CNT must be in range from 2 to 1024"
+#endif
+#if ((EMAC_TX_BUF_CNT < 1U) || (EMAC_TX_BUF_CNT > 1024U))
+  #error "EMAC_TX_BUF_CNT must be in range from 1 to 1024"
+#endif
+#if (EMAC_RX_LOAN_CNT > 1024U)
+  #error "EMAC_RX_LOAN_CNT must be in range from 0 to 1024"
+#endif
+#ifndef EMAC_RX_SHIFT16
+  #define EMAC_RX_SHIFT16       0
+#endif
+#if (EMAC_RX_SHIFT16 != 0)
+  #define EMAC_RX_OFS           2U      /* Frame data offset in receive buffer */
+#else
+  #define EMAC_RX_OFS           0U
+#endif
+#ifndef EMAC_TX_FIFO_WATERMARK
+  #if (EMAC_CHECKSUM_OFFLOAD != 0)
+    #define EMAC_TX_FIFO_WATERMARK  0U
+  #else
+    #define EMAC_TX_FIFO_WATERMARK  1U
+  #endif
+#endif
+#if (EMAC_TX_FIFO_WATERMARK > 63U)
+  #error "EMAC_TX_FIFO_WATERMARK must be in range from 0 to 63"
+#endif
+#if ((EMAC_CHECKSUM_OFFLOAD != 0) && (EMAC_TX_FIFO_WATERMARK == 0U))
+  #define EMAC_TX_CHECKSUM      1       /* Transmit checksum insertion requires store and forward */
+#else
+  #define EMAC_TX_CHECKSUM      0
+#endif
+#ifndef EMAC_RX_SLAB_CNT
+  #define EMAC_RX_SLAB_CNT      0U
+#endif
+#ifndef EMAC_RX_SLAB_SIZE
+  #define EMAC_RX_SLAB_SIZE     128U
+#endif
+#if (EMAC_RX_SLAB_CNT > 0U)
+  #if (EMAC_RX_SLAB_CNT > 1024U)
+    #error "EMAC_RX_SLAB_CNT must be in range from 0 to 1024"
+  #endif
+  #if ((EMAC_RX_SLAB_SIZE < 64U) || (EMAC_RX_SLAB_SIZE >= EMAC_BUF_SIZE) || ((EMAC_RX_SLAB_SIZE % 32U) != 0U))
+    #error "EMAC_RX_SLAB_SIZE must be a multiple of 32 in range from 64 to 1504"
+  #endif
+#endif
+#ifndef EMAC_RX_CLASS_CNT
+  #define EMAC_RX_CLASS_CNT     0U
+#endif
+#if ((EMAC_RX_SLAB_CNT > 0U) && (EMAC_RX_CLASS_CNT > 0U))
+  #error "EMAC_RX_SLAB_CNT requires EMAC_RX_CLASS_CNT 0"
+#endif
+#ifndef EMAC_RX_RULE_CNT
+  #define EMAC_RX_RULE_CNT      8U
+#endif
+#if (EMAC_RX_CLASS_CNT > 0U)
+  #if ((EMAC_RX_CLASS_CNT < 2U) || (EMAC_RX_CLASS_CNT > 4U))
+    #error "EMAC_RX_CLASS_CNT must be 0 or in range from 2 to 4"
+  #endif
+  #if ((EMAC_RX_RULE_CNT < 1U) || (EMAC_RX_RULE_CNT > 32U))
+    #error "EMAC_RX_RULE_CNT must be in range from 1 to 32"
+  #endif
+#endif
+#if ((EMAC_TX_ZERO_COPY != 0) && (EMAC_TX_BUF_CNT < 2U))
+  #error "EMAC_TX_ZERO_COPY requires at least 2 transmit buffer descriptors"
+#endif
+#if ((EMAC_TX_ZERO_COPY != 0) && (EMAC_TX_QUEUE_LEN != 0U))
+  #error "EMAC_TX_QUEUE_LEN is not supported with EMAC_TX_ZERO_COPY"
+#endif
+
+/* Transmit frame slots (descriptors and software queue) */
+#define EMAC_TX_SLOT_CNT        (EMAC_TX_BUF_CNT + EMAC_TX_QUEUE_LEN)
+
+/* Transmit queue watermarks */
+#ifndef EMAC_TX_QUEUE_HIGH
+  #define EMAC_TX_QUEUE_HIGH    ((EMAC_TX_SLOT_CNT * 3U) / 4U)
+#endif
+#ifndef EMAC_TX_QUEUE_LOW
+  #define EMAC_TX_QUEUE_LOW     (EMAC_TX_SLOT_CNT / 4U)
+#endif
+#if ((EMAC_TX_QUEUE_LEN != 0U) && ((EMAC_TX_QUEUE_LOW >= EMAC_TX_QUEUE_HIGH) || (EMAC_TX_QUEUE_HIGH > EMAC_TX_SLOT_CNT)))
+  #error "EMAC_TX_QUEUE_LOW must be below EMAC_TX_QUEUE_HIGH and EMAC_TX_QUEUE_HIGH must not exceed queue size"
+#endif
+
+/* IEEE 1588 precision timer and frame timestamps */
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+  #define EMAC_TIMESTAMP        1
+#else
+  #define EMAC_TIMESTAMP        0
+#endif
+
+/* 1588 timer clock frequency (0 = ENET peripheral clock) */
+#ifndef EMAC_PTP_CLOCK
+#define EMAC_PTP_CLOCK          0U
+#endif
+#if ((EMAC_PTP_CLOCK != 0U) && ((1000000000U % EMAC_PTP_CLOCK) != 0U))
+  #error "EMAC_PTP_CLOCK period must be an integer number of nanoseconds"
+#endif
+
+/* Timer alarm disabled by default (driver defines ENET_1588_Timer_IRQHandler when enabled) */
+#ifndef EMAC_PTP_ALARM
+  #define EMAC_PTP_ALARM        0
+#endif
+#if ((EMAC_PTP_ALARM != 0) && (EMAC_TIMESTAMP == 0))
+  #error "EMAC_PTP_ALARM requires ENET_ENHANCEDBUFFERDESCRIPTOR_MODE"
+#endif
+
+/* 1588 timer compare channel used for the timer alarm */
+#define EMAC_ALARM_CHANNEL      kENET_PtpTimerChannel3
+
+/* VLAN ID set filter */
+#ifndef EMAC_VLAN_SET
+#define EMAC_VLAN_SET           1
+#endif
+
+/* Exact multicast address table */
+#ifndef EMAC_MCAST_CNT
+#define EMAC_MCAST_CNT          16U
+#endif
+#if (EMAC_MCAST_CNT > 255U)
+  #error "EMAC_MCAST_CNT must be in range from 0 to 255"
+#endif
+
+/* Additional unicast address table */
+#ifndef EMAC_UCAST_CNT
+#define EMAC_UCAST_CNT          4U
+#endif
+#if (EMAC_UCAST_CNT > 32U)
+  #error "EMAC_UCAST_CNT must be in range from 0 to 32"
+#endif
+
+/* MDIO transaction queue */
+#ifndef EMAC_MDIO_QUEUE_LEN
+  #ifdef EMAC_PHY_INT_PIN
+  #define EMAC_MDIO_QUEUE_LEN   4U
+  #else
+  #define EMAC_MDIO_QUEUE_LEN   0U
+  #endif
+#endif
+#if (EMAC_MDIO_QUEUE_LEN > 255U)
+  #error "EMAC_MDIO_QUEUE_LEN must be in range from 0 to 255"
+#endif
+
+/* Cached PHY registers (bit mask of register addresses) */
+#ifndef EMAC_PHY_CACHE_REGS
+#define EMAC_PHY_CACHE_REGS     ((1UL << 2) | (1UL << 3) | (1UL << 15))
+#endif
+
+/* Event delivery from driver thread */
+#ifndef EMAC_EVENT_THREAD
+  #define EMAC_EVENT_THREAD     0
+#endif
+#if (EMAC_EVENT_THREAD != 0)
+  #include "cmsis_os2.h"
+  #ifndef EMAC_EVENT_QUEUE_LEN
+  #define EMAC_EVENT_QUEUE_LEN  16U
+  #endif
+  #ifndef EMAC_EVENT_THREAD_PRIO
+  #define EMAC_EVENT_THREAD_PRIO  osPriorityHigh
+  #endif
+  #ifndef EMAC_EVENT_THREAD_STACK
+  #define EMAC_EVENT_THREAD_STACK 1024U
+  #endif
+  #ifndef EMAC_MDIO_THREAD_FLAG
+  #define EMAC_MDIO_THREAD_FLAG   0x8000U
+  #endif
+  #if ((EMAC_EVENT_QUEUE_LEN < 2U) || (EMAC_EVENT_QUEUE_LEN > 256U) || \
+       ((EMAC_EVENT_QUEUE_LEN & (EMAC_EVENT_QUEUE_LEN - 1U)) != 0U))
+    #error "EMAC_EVENT_QUEUE_LEN must be a power of 2 in range from 2 to 256"
+  #endif
+  #if ((EMAC_MDIO_THREAD_FLAG < 2U) || (EMAC_MDIO_THREAD_FLAG > 0x40000000U) || \
+       ((EMAC_MDIO_THREAD_FLAG & (EMAC_MDIO_THREAD_FLAG - 1U)) != 0U))
+    #error "EMAC_MDIO_THREAD_FLAG must be a single thread flag from 0x2 to 0x40000000"
+  #endif
+#endif
+
+/* Frame latency histograms */
+#ifndef EMAC_LATENCY
+  #define EMAC_LATENCY          0
+#endif
+
+/* Periodic MIB counter accumulation in ms */
+#ifndef EMAC_STATS_PERIOD
+  #define EMAC_STATS_PERIOD     0U
+#endif
+#if (EMAC_STATS_PERIOD > 5000U)
+  #error "EMAC_STATS_PERIOD must be in range from 0 to 5000"
+#endif
+
+/* Free-running 32-bit timestamp for latency and interrupt duration measurement */
+#ifndef EMAC_CYCLE_COUNT
+  #define EMAC_CYCLE_COUNT()    (DWT->CYCCNT)
+  #define EMAC_CYCLE_DWT        1
+#else
+  #define EMAC_CYCLE_DWT        0
+#endif
+
+/* Receive interrupt entry time: recorded by the interrupt when the bookkeeping runs in the event thread */
+#if (EMAC_EVENT_THREAD != 0)
+  #define EMAC_RX_IRQ_TIME()    (Emac.ev_rx_time)
+#else
+  #define EMAC_RX_IRQ_TIME()    EMAC_CYCLE_COUNT ()
+#endif
+
+/* Frame capture ring buffer */
+#ifndef EMAC_CAPTURE_SIZE
+  #define EMAC_CAPTURE_SIZE     0U
+#endif
+#if ((EMAC_CAPTURE_SIZE > 0U) && \
+     ((EMAC_CAPTURE_SIZE < 4096U) || ((EMAC_CAPTURE_SIZE & (EMAC_CAPTURE_SIZE - 1U)) != 0U)))
+  #error "EMAC_CAPTURE_SIZE must be 0 or a power of 2 not less than 4096"
+#endif
+#define EMAC_CAP_RING_SIZE      (EMAC_CAPTURE_SIZE / 2U)
+#define EMAC_CAP_RX             0U
+#define EMAC_CAP_TX             1U
+
+/* PHY interrupt link monitor */
+#ifdef EMAC_PHY_INT_PIN
+  #define EMAC_LINK_MONITOR     1
+  #if (EMAC_MDIO_QUEUE_LEN == 0U)
+    #error "EMAC_PHY_INT_PIN requires EMAC_MDIO_QUEUE_LEN"
+  #endif
+  #ifndef EMAC_PHY_INT_REG
+  #define EMAC_PHY_INT_REG      0x1BU
+  #endif
+  #ifndef EMAC_PHY_INT_ENABLE
+  #define EMAC_PHY_INT_ENABLE   0x0500U
+  #endif
+  #include "GPIO_iMXRT1050.h"
+#else
+  #define EMAC_LINK_MONITOR     0
+#endif
+
+/* Transmit frame slot length flag: timestamp requested */
+#define EMAC_TX_LEN_TS          0x8000U
+
+/* Interrupt coalescing */
+#if (defined(FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE) && (FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE != 0))
+  #define EMAC_COALESCE         1
+#else
+  #define EMAC_COALESCE         0
+#endif
+
+/* Frame buffer placement */
+#if defined(EMAC_BUF_SECTION)
+  #define EMAC_BUF_ATTR         __attribute__((section(EMAC_BUF_SECTION)))
+#else
+  #define EMAC_BUF_ATTR
+#endif
 
 
 /* Driver Version */
@@ -130,22 +826,22 @@ static const ARM_DRIVER_VERSION DriverVersion = {
 
 /* Driver Capabilities */
 static const ARM_ETH_MAC_CAPABILITIES DriverCapabilities = {
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_rx_ip4  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_rx_ip6  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_rx_udp  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_rx_tcp  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_rx_icmp */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_tx_ip4  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_tx_ip6  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_tx_udp  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_tx_tcp  */
-  (EMAC_CHECKSUM_OFFLOAD != 0) ? 1U : 0U, /* checksum_offload_tx_icmp */
+  ((EMAC_CHECKSUM_OFFLOAD != 0) || (EMAC_RX_CHECKSUM_SW != 0)) ? 1U : 0U, /* checksum_offload_rx_ip4  */
+  ((EMAC_CHECKSUM_OFFLOAD != 0) || (EMAC_RX_CHECKSUM_SW != 0)) ? 1U : 0U, /* checksum_offload_rx_ip6  */
+  ((EMAC_CHECKSUM_OFFLOAD != 0) || (EMAC_RX_CHECKSUM_SW != 0)) ? 1U : 0U, /* checksum_offload_rx_udp  */
+  ((EMAC_CHECKSUM_OFFLOAD != 0) || (EMAC_RX_CHECKSUM_SW != 0)) ? 1U : 0U, /* checksum_offload_rx_tcp  */
+  ((EMAC_CHECKSUM_OFFLOAD != 0) || (EMAC_RX_CHECKSUM_SW != 0)) ? 1U : 0U, /* checksum_offload_rx_icmp */
+  (EMAC_TX_CHECKSUM      != 0) ? 1U : 0U, /* checksum_offload_tx_ip4  */
+  (EMAC_TX_CHECKSUM      != 0) ? 1U : 0U, /* checksum_offload_tx_ip6  */
+  (EMAC_TX_CHECKSUM      != 0) ? 1U : 0U, /* checksum_offload_tx_udp  */
+  (EMAC_TX_CHECKSUM      != 0) ? 1U : 0U, /* checksum_offload_tx_tcp  */
+  (EMAC_TX_CHECKSUM      != 0) ? 1U : 0U, /* checksum_offload_tx_icmp */
   EMAC_MII_MODE,                          /* media_interface          */
   0U,                                     /* mac_address              */
   1U,                                     /* event_rx_frame           */
   1U,                                     /* event_tx_frame           */
   1U,                                     /* event_wakeup             */
-  0U                                      /* precision_timer          */
+  (EMAC_TIMESTAMP != 0) ? 1U : 0U         /* precision_timer          */
 #if (defined(ARM_ETH_MAC_API_VERSION) && (ARM_ETH_MAC_API_VERSION >= 0x201U))
 , 0U                                      /* reserved bits            */
 #endif
@@ -153,16 +849,158 @@ static const ARM_ETH_MAC_CAPABILITIES DriverCapabilities = {
 
 
 /* Frame buffers */
-static __ALIGNED(64) uint8_t Rx_Buf[EMAC_RX_BUF_CNT][EMAC_BUF_SIZE];
-static __ALIGNED(64) uint8_t Tx_Buf[EMAC_TX_BUF_CNT][EMAC_BUF_SIZE];
+static EMAC_BUF_ATTR __ALIGNED(64) uint8_t Rx_Buf[EMAC_RX_BUF_CNT+EMAC_RX_LOAN_CNT][EMAC_BUF_SIZE];
+#if (EMAC_TX_ZERO_COPY == 0)
+static EMAC_BUF_ATTR __ALIGNED(64) uint8_t Tx_Buf[EMAC_TX_SLOT_CNT][EMAC_BUF_SIZE];
+static uint16_t Tx_Len[EMAC_TX_SLOT_CNT];
+#endif
 
 /* Frame buffer descriptors */
 AT_NONCACHEABLE_SECTION_ALIGN (static volatile enet_rx_bd_struct_t Rx_Desc[EMAC_RX_BUF_CNT], 64U);
 AT_NONCACHEABLE_SECTION_ALIGN (static volatile enet_tx_bd_struct_t Tx_Desc[EMAC_TX_BUF_CNT], 64U);
 
-/* Intermediate tx frame buffer */
-static uint8_t  Tx_IntBuf[EMAC_BUF_SIZE];
-static uint32_t Tx_IntLen;
+#if (EMAC_RX_LOAN_CNT > 0U)
+/* Receive buffer loan control */
+static uint16_t Rx_Map[EMAC_RX_BUF_CNT];                  /* Buffer index of each descriptor */
+static uint16_t Rx_Spare[EMAC_RX_LOAN_CNT];               /* Spare buffer index stack        */
+static uint16_t Rx_SpareCnt;                              /* Number of spare buffers         */
+static uint8_t  Rx_Loaned[EMAC_RX_BUF_CNT+EMAC_RX_LOAN_CNT]; /* Buffer on loan flags         */
+#endif
+
+#if (EMAC_RX_SLAB_CNT > 0U)
+/* Small frame slab pool, filled at receive time so that the ring descriptor is re-armed at once */
+static __ALIGNED(32) uint8_t Rx_Slab[EMAC_RX_SLAB_CNT][EMAC_RX_SLAB_SIZE];
+static enet_rx_bd_struct_t Rx_SlabDesc[EMAC_RX_SLAB_CNT];  /* Frame length, status, timestamp */
+static uint16_t Rx_SlabFree[EMAC_RX_SLAB_CNT];             /* Free slab index stack          */
+static uint16_t Rx_SlabCnt;                                /* Number of free slabs           */
+static uint16_t Rx_SlabQ[EMAC_RX_SLAB_CNT];                /* Received frames in ring order  */
+static uint8_t  Rx_SlabUsed[EMAC_RX_SLAB_CNT];             /* Slab on loan flags             */
+#if (EMAC_LATENCY != 0)
+static uint32_t Rx_SlabStamp[EMAC_RX_SLAB_CNT];            /* Receive interrupt timestamps   */
+static uint8_t  Rx_SlabStampOk[EMAC_RX_SLAB_CNT];          /* Slab timestamped flags         */
+#endif
+#endif
+
+#if (EMAC_RX_CLASS_CNT > 0U)
+/* Receive priority classes */
+static EMAC_RX_RULE Rx_Rule[EMAC_RX_RULE_CNT];                /* Classification rules           */
+static uint16_t Rx_Queue[EMAC_RX_CLASS_CNT][EMAC_RX_BUF_CNT]; /* Descriptor index queues        */
+static uint16_t Rx_QHead[EMAC_RX_CLASS_CNT];                  /* Queue head positions           */
+static uint16_t Rx_QCnt[EMAC_RX_CLASS_CNT];                   /* Number of queued frames        */
+static uint8_t  Rx_DescCls[EMAC_RX_BUF_CNT];                  /* Class of each descriptor       */
+static uint8_t  Rx_Done[EMAC_RX_BUF_CNT];                     /* Descriptor consumed flags      */
+#endif
+
+#if (EMAC_VLAN_SET != 0)
+/* VLAN ID set filter bitmap */
+static uint32_t Vlan_Map[4096U/32U];
+#endif
+
+/* ENET MIB counter map: register offset, EMAC_STATS member offset, counter mask */
+static const struct {
+  uint16_t reg;
+  uint16_t ofs;
+  uint32_t mask;
+} Stats_Map[] = {
+  { offsetof(ENET_Type, RMON_T_PACKETS),   offsetof(EMAC_STATS, tx_frames),      0xFFFFU      },
+  { offsetof(ENET_Type, RMON_T_BC_PKT),    offsetof(EMAC_STATS, tx_broadcast),   0xFFFFU      },
+  { offsetof(ENET_Type, RMON_T_MC_PKT),    offsetof(EMAC_STATS, tx_multicast),   0xFFFFU      },
+  { offsetof(ENET_Type, RMON_T_OCTETS),    offsetof(EMAC_STATS, tx_octets),      0xFFFFFFFFU  },
+  { offsetof(ENET_Type, IEEE_T_FRAME_OK),  offsetof(EMAC_STATS, tx_frames_ok),   0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_1COL),      offsetof(EMAC_STATS, tx_single_col),  0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_MCOL),      offsetof(EMAC_STATS, tx_multi_col),   0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_DEF),       offsetof(EMAC_STATS, tx_deferred),    0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_LCOL),      offsetof(EMAC_STATS, tx_late_col),    0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_EXCOL),     offsetof(EMAC_STATS, tx_excess_col),  0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_MACERR),    offsetof(EMAC_STATS, tx_underrun),    0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_CSERR),     offsetof(EMAC_STATS, tx_carrier_err), 0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_T_FDXFC),     offsetof(EMAC_STATS, tx_pause),       0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_PACKETS),   offsetof(EMAC_STATS, rx_frames),      0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_BC_PKT),    offsetof(EMAC_STATS, rx_broadcast),   0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_MC_PKT),    offsetof(EMAC_STATS, rx_multicast),   0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_OCTETS),    offsetof(EMAC_STATS, rx_octets),      0xFFFFFFFFU  },
+  { offsetof(ENET_Type, IEEE_R_FRAME_OK),  offsetof(EMAC_STATS, rx_frames_ok),   0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_R_CRC),       offsetof(EMAC_STATS, rx_crc_err),     0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_R_ALIGN),     offsetof(EMAC_STATS, rx_align_err),   0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_UNDERSIZE), offsetof(EMAC_STATS, rx_undersize),   0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_OVERSIZE),  offsetof(EMAC_STATS, rx_oversize),    0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_FRAG),      offsetof(EMAC_STATS, rx_fragments),   0xFFFFU      },
+  { offsetof(ENET_Type, RMON_R_JAB),       offsetof(EMAC_STATS, rx_jabbers),     0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_R_MACERR),    offsetof(EMAC_STATS, rx_overrun),     0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_R_DROP),      offsetof(EMAC_STATS, rx_dropped),     0xFFFFU      },
+  { offsetof(ENET_Type, IEEE_R_FDXFC),     offsetof(EMAC_STATS, rx_pause),       0xFFFFU      }
+};
+#define EMAC_STATS_MIB_CNT     (sizeof(Stats_Map) / sizeof(Stats_Map[0]))
+
+/* Statistics */
+static EMAC_STATS Stats;                                    /* Accumulated counters           */
+static uint32_t   Stats_Raw[EMAC_STATS_MIB_CNT];            /* Last read MIB register values  */
+
+#if (EMAC_PHY_CACHE_REGS != 0U)
+/* PHY register cache */
+static uint16_t Phy_Cache[32];
+#endif
+
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+/* MDIO transaction queue */
+static EMAC_MDIO_XFER *Mdio_Queue[EMAC_MDIO_QUEUE_LEN];
+
+/* PHY_Read/PHY_Write transaction */
+typedef struct {
+  EMAC_MDIO_XFER xfer;                  /* Transaction, first member (cb_done argument) */
+#if (EMAC_EVENT_THREAD != 0)
+  osThreadId_t   thread;                /* Waiting thread (NULL = polling)              */
+#endif
+} MDIO_WAIT;
+
+/* SDK ENET interrupt handler */
+extern void ENET_DriverIRQHandler (void);
+#endif
+
+#if (EMAC_PTP_ALARM != 0)
+/* SDK ENET 1588 timer interrupt handler */
+extern void ENET_1588_Timer_DriverIRQHandler (void);
+#endif
+
+#if (EMAC_LINK_MONITOR != 0)
+/* PHY registers read on link interrupt: interrupt status, BMSR, ANAR, ANLPAR */
+static const uint8_t Link_RegAddr[4] = { EMAC_PHY_INT_REG, 1U, 4U, 5U };
+static uint16_t       Link_Reg[4];                          /* PHY register values            */
+static EMAC_MDIO_XFER Link_Xfer;                            /* PHY register read transaction  */
+#endif
+
+#if (EMAC_MCAST_CNT > 0U)
+/* Exact multicast address table */
+static ARM_ETH_MAC_ADDR Mc_Addr[EMAC_MCAST_CNT];            /* Multicast addresses            */
+static uint32_t         Mc_Hit [EMAC_MCAST_CNT];            /* Received frames per address    */
+#endif
+
+#if (EMAC_UCAST_CNT > 0U)
+/* Additional unicast address table */
+static ARM_ETH_MAC_ADDR Uc_Addr[EMAC_UCAST_CNT];            /* Unicast addresses              */
+#endif
+
+#if (EMAC_EVENT_THREAD != 0)
+/* Event records posted from interrupt to event thread */
+static uint32_t Ev_Queue[EMAC_EVENT_QUEUE_LEN];
+#endif
+
+#if (EMAC_LATENCY != 0)
+/* Latency histograms and frame timestamps */
+static uint32_t Lat_Hist[3][EMAC_LATENCY_BINS];
+static uint32_t Rx_Stamp[EMAC_RX_BUF_CNT];                  /* Receive interrupt timestamps   */
+static uint8_t  Rx_StampOk[EMAC_RX_BUF_CNT];                /* Descriptor timestamped flags   */
+static uint32_t Tx_Stamp[EMAC_TX_BUF_CNT];                  /* SendFrame entry timestamps     */
+static uint8_t  Tx_StampOk[EMAC_TX_BUF_CNT];                /* Descriptor timestamped flags   */
+#if (EMAC_TX_ZERO_COPY == 0)
+static uint32_t Tx_SlotStamp[EMAC_TX_SLOT_CNT];             /* SendFrame entry of queued frames */
+#endif
+#endif
+
+#if (EMAC_CAPTURE_SIZE > 0U)
+/* Frame capture ring buffers for receive and transmit (pcap records, padded to 4 bytes) */
+static __ALIGNED(4) uint8_t Cap_Buf[2][EMAC_CAP_RING_SIZE];
+#endif
 
 /* EMAC control structure */
 static EMAC_INFO Emac = { 0 };
@@ -170,316 +1008,3466 @@ static EMAC_INFO Emac = { 0 };
 /* ENET interrupt handler callback function */
 static void ENET_IRQCallback (ENET_Type *base, enet_handle_t *handle, enet_event_t event, enet_frame_info_t *frameInfo, void *userData);
 
+#if (EMAC_EVENT_THREAD != 0)
+/* Event thread function */
+static void EventThread (void *arg);
+#endif
+
 /**
-  \fn          ARM_DRIVER_VERSION ARM_ETH_MAC_GetVersion (void)
-  \brief       Get driver version.
-  \return      \ref ARM_DRIVER_VERSION
+  \fn          void EnetIrqEnable (uint32_t mask)
+  \brief       Enable ENET interrupts.
+  \param[in]   mask  Interrupt mask
+  \note        EIMR is modified from thread mode and from the ENET interrupt, read-modify-write is atomic.
 */
-static ARM_DRIVER_VERSION GetVersion (void) {
-  return DriverVersion;
+static void EnetIrqEnable (uint32_t mask) {
+  uint32_t primask;
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  ENET->EIMR |= mask;
+  __set_PRIMASK (primask);
 }
 
+/**
+  \fn          void EnetIrqDisable (uint32_t mask)
+  \brief       Disable ENET interrupts.
+  \param[in]   mask  Interrupt mask
+*/
+static void EnetIrqDisable (uint32_t mask) {
+  uint32_t primask;
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  ENET->EIMR &= ~mask;
+  __set_PRIMASK (primask);
+}
 
 /**
-  \fn          ARM_ETH_MAC_CAPABILITIES GetCapabilities (void)
-  \brief       Get driver capabilities.
-  \return      \ref ARM_ETH_MAC_CAPABILITIES
+  \fn          void SignalEvent (uint32_t event)
+  \brief       Signal events to the middleware, directly or through the event thread.
+  \param[in]   event  Event mask (0 = no event)
 */
-static ARM_ETH_MAC_CAPABILITIES GetCapabilities (void) {
-  return DriverCapabilities;
+static void SignalEvent (uint32_t event) {
+#if (EMAC_EVENT_THREAD != 0)
+  uint32_t val;
+
+  if (event == 0U) {
+    return;
+  }
+
+  /* Merge into event flag word, any context may post */
+  do {
+    val = __LDREXW (&Emac.ev_flags);
+  } while (__STREXW (val | event, &Emac.ev_flags) != 0U);
+
+  (void)osThreadFlagsSet ((osThreadId_t)Emac.ev_thread, 1U);
+#else
+  if ((event != 0U) && (Emac.cb_event != NULL)) {
+    Emac.cb_event (event);
+  }
+#endif
+}
+
+#if (EMAC_EVENT_THREAD != 0)
+/**
+  \fn          void EventPut (uint32_t event)
+  \brief       Post event record from the ENET interrupt to the event thread.
+  \param[in]   event  Event mask
+  \note        The ENET interrupt is the only producer and the event thread the only consumer of the ring.
+*/
+static void EventPut (uint32_t event) {
+  uint32_t put = Emac.ev_put;
+
+  if ((put - Emac.ev_get) < EMAC_EVENT_QUEUE_LEN) {
+    Ev_Queue[put & (EMAC_EVENT_QUEUE_LEN - 1U)] = event;
+    __DMB ();
+    Emac.ev_put = put + 1U;
+    (void)osThreadFlagsSet ((osThreadId_t)Emac.ev_thread, 1U);
+  } else {
+    /* Ring full, merge into next batch */
+    Stats.ev_overflow++;
+    SignalEvent (event);
+  }
+}
+#endif
+
+/**
+  \fn          void StatsUpdate (uint32_t baseline)
+  \brief       Accumulate ENET MIB counters into driver statistics.
+  \param[in]   baseline  0 = accumulate counter increments, 1 = only read current register values
+*/
+static void StatsUpdate (uint32_t baseline) {
+  uint32_t primask;
+  uint32_t val, i;
+  uint32_t *cnt;
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+
+  for (i = 0U; i < EMAC_STATS_MIB_CNT; i++) {
+    val = *(volatile uint32_t *)((uint32_t)ENET + Stats_Map[i].reg) & Stats_Map[i].mask;
+    if (baseline == 0U) {
+      cnt   = (uint32_t *)((uint8_t *)&Stats + Stats_Map[i].ofs);
+      *cnt += (val - Stats_Raw[i]) & Stats_Map[i].mask;
+    }
+    Stats_Raw[i] = val;
+  }
+
+  __set_PRIMASK (primask);
+}
+
+#if (EMAC_STATS_PERIOD != 0U)
+/**
+  \fn          void StatsPoll (void)
+  \brief       Accumulate ENET MIB counters when the statistics period has elapsed.
+  \note        Called from ENET interrupt, event thread and EMAC_PollRx while the driver is powered.
+*/
+static void StatsPoll (void) {
+  uint32_t now = EMAC_CYCLE_COUNT ();
+
+  if ((now - Emac.stats_time) >= ((SystemCoreClock / 1000U) * EMAC_STATS_PERIOD)) {
+    Emac.stats_time = now;
+    StatsUpdate (0U);
+  }
+}
+#endif
+
+/**
+  \fn          void FlowApply (void)
+  \brief       Write flow control configuration to peripheral.
+*/
+static void FlowApply (void) {
+
+  if (Emac.fc_quanta != 0U) {
+    ENET->OPD  = ENET_OPD_PAUSE_DUR(Emac.fc_quanta);
+    ENET->RSEM = (ENET->RSEM & ~ENET_RSEM_RX_SECTION_EMPTY_MASK) | ENET_RSEM_RX_SECTION_EMPTY(Emac.fc_empty);
+    ENET->RSFL = ENET_RSFL_RX_SECTION_FULL(Emac.fc_full);
+    ENET->RCR |= ENET_RCR_FCE_MASK;
+  } else {
+    ENET->RCR &= ~ENET_RCR_FCE_MASK;
+    ENET->RSEM = (ENET->RSEM & ~ENET_RSEM_RX_SECTION_EMPTY_MASK);
+    ENET->RSFL = 0U;
+  }
+}
+
+#if (EMAC_UCAST_CNT > 0U)
+/**
+  \fn          uint32_t AddrHash (const uint8_t *addr)
+  \brief       Calculate ENET address hash table index (6 most significant bits of the address CRC-32).
+  \param[in]   addr  Pointer to MAC address
+  \return      hash table bit index (0..63)
+*/
+static uint32_t AddrHash (const uint8_t *addr) {
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t i, j;
+
+  for (i = 0U; i < 6U; i++) {
+    crc ^= addr[i];
+    for (j = 0U; j < 8U; j++) {
+      if ((crc & 1U) != 0U) {
+        crc = (crc >> 1) ^ 0xEDB88320U;
+      } else {
+        crc =  crc >> 1;
+      }
+    }
+  }
+  return (crc >> 26);
+}
+
+/**
+  \fn          void UcastApply (void)
+  \brief       Write individual address hash table for additional unicast addresses to peripheral.
+*/
+static void UcastApply (void) {
+  uint32_t ialr = 0U;
+  uint32_t iaur = 0U;
+  uint32_t i, bit;
+
+  for (i = 0U; i < Emac.uc_cnt; i++) {
+    bit = AddrHash (&Uc_Addr[i].b[0]);
+    if ((bit & 0x20U) != 0U) {
+      iaur |= (1UL << (bit & 0x1FU));
+    } else {
+      ialr |= (1UL << bit);
+    }
+  }
+  ENET->IALR = ialr;
+  ENET->IAUR = iaur;
+}
+
+/**
+  \fn          uint32_t UcastMatch (const uint8_t *frame)
+  \brief       Check received unicast frame against station and additional unicast addresses.
+  \param[in]   frame  Pointer to frame data
+  \return      1 = frame accepted, 0 = frame rejected
+*/
+static uint32_t UcastMatch (const uint8_t *frame) {
+  uint32_t i;
+
+  if (memcmp (Emac.addr, frame, 6U) == 0) {
+    /* Station address */
+    return (1U);
+  }
+
+  for (i = 0U; i < Emac.uc_cnt; i++) {
+    if (memcmp (&Uc_Addr[i], frame, 6U) == 0) {
+      return (1U);
+    }
+  }
+  return (0U);
+}
+#endif
+
+#if (EMAC_RX_CLASS_CNT > 0U)
+/**
+  \fn          void RxClassReset (void)
+  \brief       Empty receive class queues.
+*/
+static void RxClassReset (void) {
+
+  memset (Rx_QHead,   0, sizeof(Rx_QHead));
+  memset (Rx_QCnt,    0, sizeof(Rx_QCnt));
+  memset (Rx_Done,    0, sizeof(Rx_Done));
+  Emac.rx_scan = 0U;
+  Emac.rx_held = 0U;
+  Emac.rx_cur  = 0U;
+  Emac.rx_pin  = 0U;
+}
+#endif
+
+#if (EMAC_RX_SLAB_CNT > 0U)
+/**
+  \fn          void RxSlabDequeue (uint32_t loan)
+  \brief       Remove oldest frame from slab queue.
+  \param[in]   loan  0 = frame was read, slab is free, 1 = slab is on loan
+*/
+static void RxSlabDequeue (uint32_t loan) {
+  uint32_t primask;
+  uint32_t idx;
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  idx = Rx_SlabQ[Emac.slab_get];
+  if (++Emac.slab_get == EMAC_RX_SLAB_CNT) {
+    Emac.slab_get = 0U;
+  }
+  Emac.slab_qcnt--;
+  if (loan != 0U) {
+    Rx_SlabUsed[idx] = 1U;
+  } else {
+    Rx_SlabFree[Rx_SlabCnt++] = (uint16_t)idx;
+  }
+  __set_PRIMASK (primask);
+}
+
+/**
+  \fn          void RxSlabReset (void)
+  \brief       Discard frames in slab queue, slabs on loan are kept.
+*/
+static void RxSlabReset (void) {
+  while (Emac.slab_qcnt != 0U) {
+    RxSlabDequeue (0U);
+  }
+  Emac.rx_own = 0U;
+}
+#endif
+
+/**
+  \fn          void RingInit (void)
+  \brief       Initialize receive and transmit ring state after ENET_Init.
+*/
+static void RingInit (void) {
+#if (EMAC_RX_LOAN_CNT > 0U)
+  uint32_t i;
+
+  /* Restore buffer assignment, descriptors may hold buffers from the spare pool */
+  for (i = 0U; i < EMAC_RX_BUF_CNT; i++) {
+    Rx_Desc[i].buffer = (uint32_t)&Rx_Buf[Rx_Map[i]][0];
+  }
+#endif
+  Emac.rx_idx  = 0U;
+  Emac.rx_skip = 0U;
+  Emac.rx_polling = 0U;
+#if (EMAC_RX_CLASS_CNT > 0U)
+  RxClassReset ();
+#endif
+#if (EMAC_RX_SLAB_CNT > 0U)
+  RxSlabReset ();
+#endif
+
+  Emac.tx_idx   = 0U;
+  Emac.tx_cidx  = 0U;
+  Emac.tx_first = 0U;
+  Emac.tx_frag  = 0U;
+  Emac.tx_put   = 0U;
+  Emac.tx_sub   = 0U;
+  Emac.tx_qcnt  = 0U;
+  Emac.tx_dcnt  = 0U;
+  Emac.tx_wm    = 0U;
+  Emac.tx_len   = 0U;
+
+#if (EMAC_LATENCY != 0)
+  memset (Rx_StampOk, 0, sizeof(Rx_StampOk));
+  memset (Tx_StampOk, 0, sizeof(Tx_StampOk));
+  Emac.lat_rx_idx = 0U;
+  Emac.lat_tx_idx = 0U;
+#endif
+}
+
+#if (EMAC_LATENCY != 0)
+/**
+  \fn          void LatencyAdd (uint32_t type, uint32_t time)
+  \brief       Add interval to latency histogram.
+  \param[in]   type  Histogram (EMAC_LATENCY_...)
+  \param[in]   time  Interval in timestamp ticks
+*/
+static void LatencyAdd (uint32_t type, uint32_t time) {
+  uint32_t bin = 31U - __CLZ (time | 1U);
+
+  if (bin >= EMAC_LATENCY_BINS) {
+    bin = EMAC_LATENCY_BINS - 1U;
+  }
+  Lat_Hist[type][bin]++;
+}
+
+/**
+  \fn          void LatencyRxStamp (uint32_t time)
+  \brief       Timestamp received frames, called for the receive interrupt.
+  \param[in]   time  EMAC_CYCLE_COUNT at receive interrupt entry
+*/
+static void LatencyRxStamp (uint32_t time) {
+  uint32_t idx = Emac.lat_rx_idx;
+  uint32_t n;
+
+  if ((Rx_StampOk[Emac.rx_idx] == 0U) &&
+      ((Rx_Desc[Emac.rx_idx].control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) == 0U)) {
+    /* Oldest frame not timestamped (received while receive interrupt was masked) */
+    idx = Emac.rx_idx;
+  }
+
+  for (n = 0U; n < EMAC_RX_BUF_CNT; n++) {
+    if (((Rx_Desc[idx].control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) != 0U) || (Rx_StampOk[idx] != 0U)) {
+      break;
+    }
+    Rx_Stamp[idx]   = time;
+    Rx_StampOk[idx] = 1U;
+    if (++idx == EMAC_RX_BUF_CNT) {
+      idx = 0U;
+    }
+  }
+  Emac.lat_rx_idx = (uint16_t)idx;
+}
+
+/**
+  \fn          void LatencyRxRead (volatile enet_rx_bd_struct_t *bd)
+  \brief       Add receive latency of frame which was read.
+  \param[in]   bd  Pointer to receive descriptor
+*/
+static void LatencyRxRead (volatile enet_rx_bd_struct_t *bd) {
+  uint32_t idx;
+
+#if (EMAC_RX_SLAB_CNT > 0U)
+  if ((bd >= Rx_SlabDesc) && (bd < &Rx_SlabDesc[EMAC_RX_SLAB_CNT])) {
+    /* Frame copied into slab, timestamp was copied along */
+    idx = (uint32_t)(bd - Rx_SlabDesc);
+    if (Rx_SlabStampOk[idx] != 0U) {
+      LatencyAdd (EMAC_LATENCY_RX_READ, EMAC_CYCLE_COUNT () - Rx_SlabStamp[idx]);
+    }
+    return;
+  }
+#endif
+  idx = (uint32_t)(bd - Rx_Desc);
+  if (Rx_StampOk[idx] != 0U) {
+    LatencyAdd (EMAC_LATENCY_RX_READ, EMAC_CYCLE_COUNT () - Rx_Stamp[idx]);
+  }
+}
+
+/**
+  \fn          void LatencyTxDone (uint32_t time)
+  \brief       Add transmit latency of completed frames, called for the transmit interrupt.
+  \param[in]   time  EMAC_CYCLE_COUNT at transmit interrupt entry
+*/
+static void LatencyTxDone (uint32_t time) {
+  uint32_t idx = Emac.lat_tx_idx;
+
+  while (idx != Emac.tx_idx) {
+    if ((Tx_Desc[idx].control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0U) {
+      /* Frame not yet transmitted */
+      break;
+    }
+    if (Tx_StampOk[idx] != 0U) {
+      Tx_StampOk[idx] = 0U;
+      LatencyAdd (EMAC_LATENCY_TX_DONE, time - Tx_Stamp[idx]);
+    }
+    if (++idx == EMAC_TX_BUF_CNT) {
+      idx = 0U;
+    }
+  }
+  Emac.lat_tx_idx = (uint16_t)idx;
 }
+#endif
+
+#if (EMAC_TX_ZERO_COPY == 0)
+/**
+  \fn          void TxReclaim (void)
+  \brief       Reclaim all transmitted descriptors.
+*/
+static void TxReclaim (void) {
+
+  while (Emac.tx_dcnt != 0U) {
+    if ((Tx_Desc[Emac.tx_cidx].control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0U) {
+      /* Frame not yet transmitted */
+      break;
+    }
+    if (++Emac.tx_cidx == EMAC_TX_BUF_CNT) {
+      Emac.tx_cidx = 0U;
+    }
+    Emac.tx_dcnt--;
+  }
+}
+
+/**
+  \fn          void TxSubmit (void)
+  \brief       Hand over queued frames to free transmit descriptors.
+*/
+static void TxSubmit (void) {
+  volatile enet_tx_bd_struct_t *bd;
+  uint32_t cnt = 0U;
+
+  while ((Emac.tx_qcnt != 0U) && (Emac.tx_dcnt < EMAC_TX_BUF_CNT)) {
+    bd = &Tx_Desc[Emac.tx_idx];
+
+    bd->buffer = (uint32_t)&Tx_Buf[Emac.tx_sub][0];
+    bd->length = Tx_Len[Emac.tx_sub] & ~EMAC_TX_LEN_TS;
+#if (EMAC_TIMESTAMP != 0)
+    if ((Tx_Len[Emac.tx_sub] & EMAC_TX_LEN_TS) != 0U) {
+      /* Capture transmit timestamp */
+      bd->controlExtend1 = ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK | ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
+      Emac.tx_ts_idx     = Emac.tx_idx;
+      Emac.tx_ts         = 1U;
+    } else {
+      bd->controlExtend1 = ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK;
+    }
+#endif
+#if (EMAC_LATENCY != 0)
+    Tx_Stamp[Emac.tx_idx]   = Tx_SlotStamp[Emac.tx_sub];
+    Tx_StampOk[Emac.tx_idx] = 1U;
+#endif
+    __DMB ();
+    bd->control = (bd->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK) | ENET_BUFFDESCRIPTOR_TX_READY_MASK |
+                   ENET_BUFFDESCRIPTOR_TX_LAST_MASK | ENET_BUFFDESCRIPTOR_TX_TRANMITCRC_MASK;
+
+    if (++Emac.tx_idx == EMAC_TX_BUF_CNT) {
+      Emac.tx_idx = 0U;
+    }
+    if (++Emac.tx_sub == EMAC_TX_SLOT_CNT) {
+      Emac.tx_sub = 0U;
+    }
+    Emac.tx_qcnt--;
+    Emac.tx_dcnt++;
+    cnt++;
+  }
+
+  if (cnt != 0U) {
+    ENET->TDAR = ENET_TDAR_TDAR_MASK;
+  }
+}
+#endif
+
+/**
+  \fn          void RxDescRelease (volatile enet_rx_bd_struct_t *bd)
+  \brief       Return receive descriptor to DMA and advance to the next descriptor.
+  \param[in]   bd  Pointer to current receive descriptor
+*/
+static void RxDescRelease (volatile enet_rx_bd_struct_t *bd) {
+#if (EMAC_LATENCY != 0)
+  uint32_t primask;
+
+  /* Clear timestamp before the descriptor is returned, the receive interrupt
+     must neither see the stale flag of a new frame nor stamp the old frame */
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  Rx_StampOk[bd - Rx_Desc] = 0U;
+  __DMB ();
+  bd->control = (bd->control & ENET_BUFFDESCRIPTOR_RX_WRAP_MASK) | ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK;
+  __set_PRIMASK (primask);
+#else
+  bd->control = (bd->control & ENET_BUFFDESCRIPTOR_RX_WRAP_MASK) | ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK;
+#endif
+  Emac.rx_cnt++;
+
+  if (++Emac.rx_idx == EMAC_RX_BUF_CNT) {
+    Emac.rx_idx = 0U;
+  }
+
+  /* Receive descriptor is available */
+  ENET_ActiveRead (ENET);
+}
+
+#if (EMAC_COALESCE != 0)
+/**
+  \fn          uint32_t CoalesceReg (uint32_t frames, uint32_t usec)
+  \brief       Get interrupt coalescing register value.
+  \param[in]   frames  Frame count threshold (0 = coalescing disabled)
+  \param[in]   usec    Timer threshold in microseconds (0 = coalescing disabled)
+  \return      RXIC/TXIC register value
+*/
+static uint32_t CoalesceReg (uint32_t frames, uint32_t usec) {
+  uint32_t ticks;
+
+  if ((frames == 0U) || (usec == 0U)) {
+    return (0U);
+  }
+  if (frames > 255U) {
+    frames = 255U;
+  }
+
+  /* Timer runs from ENET system clock in units of 64 clock cycles */
+  ticks = (usec * (Emac.pclk / 1000000U)) / 64U;
+  if (ticks == 0U) {
+    ticks = 1U;
+  }
+  if (ticks > 0xFFFFU) {
+    ticks = 0xFFFFU;
+  }
+
+  /* RXIC and TXIC have the same layout */
+  return (ENET_RXIC_ICEN_MASK | ENET_RXIC_ICCS_MASK | ENET_RXIC_ICFT(frames) | ENET_RXIC_ICTT(ticks));
+}
+
+/**
+  \fn          void CoalesceApply (void)
+  \brief       Write interrupt coalescing configuration to peripheral.
+*/
+static void CoalesceApply (void) {
+
+  /* Coalescing must be disabled while thresholds are changed */
+  ENET->RXIC[0] = 0U;
+  ENET->TXIC[0] = 0U;
+  ENET->RXIC[0] = Emac.rx_ic;
+  ENET->TXIC[0] = Emac.tx_ic;
+}
+
+/**
+  \fn          void CoalesceAdapt (uint32_t now)
+  \brief       Adapt receive interrupt coalescing to the number of frames handled per interrupt.
+  \param[in]   now  EMAC_CYCLE_COUNT at receive interrupt entry
+*/
+static void CoalesceAdapt (uint32_t now) {
+  uint32_t cnt, thr, gap;
+
+  gap = now - Emac.ic_time;
+  Emac.ic_time = now;
+  cnt = Emac.rx_cnt - Emac.ic_cnt;
+  Emac.ic_cnt = Emac.rx_cnt;
+
+  if (Emac.ic_hold != 0U) {
+    /* Frames are counted when read: the first count after a change belongs to the previous threshold */
+    Emac.ic_hold = 0U;
+    return;
+  }
+
+  thr = Emac.ic_frames;
+  if (thr == 1U) {
+    if (gap >= ((uint32_t)Emac.ic_usec * (SystemCoreClock / 1000000U))) {
+      /* Interrupts further apart than the maximum delay, coalescing would only add latency */
+      return;
+    }
+    thr = 2U;
+  }
+  else if (cnt >= thr) {
+    /* Load increasing, widen coalescing */
+    thr <<= 1;
+    if (thr > Emac.ic_max) {
+      thr = Emac.ic_max;
+    }
+  }
+  else if ((cnt < (thr >> 1)) || (cnt < 2U)) {
+    /* Load decreasing, narrow coalescing (timer expired with a single frame: per frame interrupt) */
+    thr >>= 1;
+  }
+  else {
+    return;
+  }
+
+  if (thr != Emac.ic_frames) {
+    Emac.ic_frames = (uint8_t)thr;
+    Emac.rx_ic     = (thr > 1U) ? CoalesceReg (thr, Emac.ic_usec) : 0U;
+    Emac.ic_hold   = 1U;
+    ENET->RXIC[0]  = 0U;
+    ENET->RXIC[0]  = Emac.rx_ic;
+  }
+}
+#endif
+
+/**
+  \fn          uint32_t VlanMatch (const uint8_t *frame, uint32_t len)
+  \brief       Check received frame against VLAN filter.
+  \param[in]   frame  Pointer to frame data
+  \param[in]   len    Frame length in bytes
+  \return      1 = frame accepted, 0 = frame rejected
+*/
+static uint32_t VlanMatch (const uint8_t *frame, uint32_t len) {
+  uint32_t tag;
+
+  if ((len < 18U) || (frame[12] != 0x81U) || (frame[13] != 0x00U)) {
+    /* Untagged frame */
+    return (0U);
+  }
+  tag = ((uint32_t)frame[14] << 8) | frame[15];
+
+  if ((Emac.vlan_mask != 0U) && ((tag & Emac.vlan_mask) == Emac.vlan_tag)) {
+    /* Exact VLAN tag match */
+    return (1U);
+  }
+#if (EMAC_VLAN_SET != 0)
+  tag &= 0x0FFFU;
+  if ((Vlan_Map[tag >> 5] & (1UL << (tag & 0x1FU))) != 0U) {
+    /* VLAN ID in set */
+    return (1U);
+  }
+#endif
+  return (0U);
+}
+
+#if (EMAC_MCAST_CNT > 0U)
+/**
+  \fn          uint32_t McastMatch (const uint8_t *frame)
+  \brief       Check received multicast frame against exact multicast address table.
+  \param[in]   frame  Pointer to frame data
+  \return      1 = frame accepted, 0 = frame rejected
+*/
+static uint32_t McastMatch (const uint8_t *frame) {
+  uint32_t i;
+
+  if ((frame[0] & frame[1] & frame[2] & frame[3] & frame[4] & frame[5]) == 0xFFU) {
+    /* Broadcast frame */
+    return (1U);
+  }
+
+  for (i = 0U; i < Emac.mc_cnt; i++) {
+    if (memcmp (&Mc_Addr[i], frame, 6U) == 0) {
+      Mc_Hit[i]++;
+      return (1U);
+    }
+  }
+  return (0U);
+}
+#endif
+
+#if (EMAC_CAPTURE_SIZE > 0U)
+/**
+  \fn          void CaptureCopy (uint32_t dir, const void *data, uint32_t len)
+  \brief       Copy data into capture ring at the current write position.
+  \param[in]   dir   Capture ring (EMAC_CAP_RX or EMAC_CAP_TX)
+  \param[in]   data  Pointer to data
+  \param[in]   len   Number of bytes to copy
+*/
+static void CaptureCopy (uint32_t dir, const void *data, uint32_t len) {
+  EMAC_CAP_RING *r = &Emac.cap[dir];
+  uint32_t idx, cnt;
+
+  idx = r->pos & (EMAC_CAP_RING_SIZE - 1U);
+  cnt = EMAC_CAP_RING_SIZE - idx;
+  if (cnt > len) {
+    cnt = len;
+  }
+  memcpy (&Cap_Buf[dir][idx], data, cnt);
+  if (cnt < len) {
+    /* Wrap around */
+    memcpy (&Cap_Buf[dir][0], (const uint8_t *)data + cnt, len - cnt);
+  }
+  r->pos += len;
+}
+
+/**
+  \fn          uint32_t CaptureBegin (uint32_t dir, uint32_t len)
+  \brief       Apply sampling, reserve ring space and write pcap record header.
+  \param[in]   dir   Capture ring (EMAC_CAP_RX or EMAC_CAP_TX)
+  \param[in]   len   Frame length in bytes
+  \return      number of frame bytes to capture (0 = frame not captured)
+  \note        Claims the ring for the calling producer until CaptureEnd. A frame read or sent by another thread
+               (or interrupt) while the ring is claimed is not captured and counted in cap_drop.
+*/
+static uint32_t CaptureBegin (uint32_t dir, uint32_t len) {
+  EMAC_CAP_RING *r = &Emac.cap[dir];
+  uint32_t hdr[4];
+  uint32_t primask;
+  uint32_t incl, busy;
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  busy    = r->busy;
+  r->busy = 1U;
+  __set_PRIMASK (primask);
+  if (busy != 0U) {
+    /* Record of another producer being written */
+    Stats.cap_drop++;
+    return (0U);
+  }
+
+  if (++r->cnt < Emac.cap_sample) {
+    /* Frame not sampled */
+    r->busy = 0U;
+    return (0U);
+  }
+  r->cnt = 0U;
+
+  incl = (len < Emac.cap_snap) ? len : Emac.cap_snap;
+  if ((16U + ((incl + 3U) & ~3U)) > (EMAC_CAP_RING_SIZE - (r->head - r->tail))) {
+    /* Ring full */
+    Stats.cap_drop++;
+    r->busy = 0U;
+    return (0U);
+  }
+
+  EMAC_CaptureTime (&hdr[0], &hdr[1]);
+  hdr[2] = incl;
+  hdr[3] = len;
+
+  r->pos = r->head;
+  CaptureCopy (dir, hdr, sizeof(hdr));
+  r->rem = incl;
+
+  return (incl);
+}
+
+/**
+  \fn          void CaptureData (uint32_t dir, const uint8_t *data, uint32_t len)
+  \brief       Append frame data to the current capture record, up to the snap length.
+  \param[in]   dir   Capture ring (EMAC_CAP_RX or EMAC_CAP_TX)
+  \param[in]   data  Pointer to frame data
+  \param[in]   len   Number of bytes
+*/
+static void CaptureData (uint32_t dir, const uint8_t *data, uint32_t len) {
+  EMAC_CAP_RING *r = &Emac.cap[dir];
+
+  if (len > r->rem) {
+    len = r->rem;
+  }
+  CaptureCopy (dir, data, len);
+  r->rem -= len;
+}
+
+/**
+  \fn          void CaptureEnd (uint32_t dir)
+  \brief       Publish the current capture record to the consumer and release the ring.
+  \param[in]   dir   Capture ring (EMAC_CAP_RX or EMAC_CAP_TX)
+*/
+static void CaptureEnd (uint32_t dir) {
+  EMAC_CAP_RING *r = &Emac.cap[dir];
+
+  __DMB ();
+  r->head = (r->pos + 3U) & ~3U;
+  r->busy = 0U;
+}
+
+/**
+  \fn          void CaptureFrame (uint32_t dir, const uint8_t *frame, uint32_t len)
+  \brief       Capture contiguous frame.
+  \param[in]   dir    Capture ring (EMAC_CAP_RX or EMAC_CAP_TX)
+  \param[in]   frame  Pointer to frame data
+  \param[in]   len    Frame length in bytes
+*/
+static void CaptureFrame (uint32_t dir, const uint8_t *frame, uint32_t len) {
+
+  if (CaptureBegin (dir, len) != 0U) {
+    CaptureData (dir, frame, len);
+    CaptureEnd (dir);
+  }
+}
+
+/**
+  \fn          void CaptureFetch (uint32_t dir, uint32_t pos, uint8_t *buf, uint32_t len)
+  \brief       Copy data from capture ring.
+  \param[in]   dir   Capture ring (EMAC_CAP_RX or EMAC_CAP_TX)
+  \param[in]   pos   Ring read position
+  \param[out]  buf   Pointer to destination buffer
+  \param[in]   len   Number of bytes to copy
+*/
+static void CaptureFetch (uint32_t dir, uint32_t pos, uint8_t *buf, uint32_t len) {
+  uint32_t idx, cnt;
+
+  idx = pos & (EMAC_CAP_RING_SIZE - 1U);
+  cnt = EMAC_CAP_RING_SIZE - idx;
+  if (cnt > len) {
+    cnt = len;
+  }
+  memcpy (buf, &Cap_Buf[dir][idx], cnt);
+  if (cnt < len) {
+    memcpy (buf + cnt, &Cap_Buf[dir][0], len - cnt);
+  }
+}
+#endif
+
+/**
+  \fn          uint32_t RxDescCheck (volatile enet_rx_bd_struct_t *bd)
+  \brief       Check received frame in descriptor: errors, multi-buffer frames and software filters.
+  \param[in]   bd  Pointer to filled receive descriptor
+  \return      1 = valid frame, 0 = frame must be discarded
+*/
+static uint32_t RxDescCheck (volatile enet_rx_bd_struct_t *bd) {
+  const uint8_t *frame;
+  uint32_t err;
+  uint16_t ctrl;
+
+  ctrl = bd->control;
+  err  = ctrl & ENET_BUFFDESCRIPTOR_RX_ERR_MASK;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+  /* MAC, PHY and collision errors are reported in the enhanced descriptor */
+  err |= bd->controlExtend1 & ENET_BUFFDESCRIPTOR_RX_EXT_ERR_MASK;
+#endif
+  if (bd->length <= EMAC_RX_OFS) {
+    /* No frame data */
+    err = 1U;
+  }
+
+  if ((ctrl & ENET_BUFFDESCRIPTOR_RX_LAST_MASK) == 0U) {
+    /* Frame does not fit into single buffer, discard up to the last buffer */
+    Emac.rx_skip = 1U;
+  }
+  else if (Emac.rx_skip != 0U) {
+    /* Last buffer of discarded frame */
+    Emac.rx_skip = 0U;
+    Stats.rx_err_drop++;
+  }
+  else if (err == 0U) {
+    /* Valid frame */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr ((void *)bd->buffer, (int32_t)bd->length);
+#endif
+    frame = (const uint8_t *)bd->buffer + EMAC_RX_OFS;
+    if ((Emac.vlan_flt != 0U) && (VlanMatch (frame, bd->length - EMAC_RX_OFS) == 0U)) {
+      /* Frame rejected by VLAN filter */
+      Stats.rx_vlan_drop++;
+    }
+#if (EMAC_MCAST_CNT > 0U)
+    else if ((Emac.mc_flt != 0U) && ((frame[0] & 0x01U) != 0U) && (McastMatch (frame) == 0U)) {
+      /* Multicast hash filter false positive */
+      Emac.mc_fp++;
+      Stats.rx_mcast_drop++;
+    }
+#endif
+#if (EMAC_UCAST_CNT > 0U)
+    else if ((Emac.uc_flt != 0U) && ((frame[0] & 0x01U) == 0U) && (UcastMatch (frame) == 0U)) {
+      /* Individual address hash filter false positive */
+      Stats.rx_ucast_drop++;
+    }
+#endif
+#if (EMAC_RX_CHECKSUM_SW != 0) && (EMAC_RX_CLASS_CNT == 0U)
+    else if ((Emac.rx_csum != 0U) && (EMAC_ChecksumVerifyFrame (frame, bd->length - EMAC_RX_OFS) == 0U)) {
+      /* IP header or protocol checksum error */
+      Stats.rx_csum_drop++;
+    }
+#endif
+    else {
+      return (1U);
+    }
+  }
+  else {
+    /* Frame received with error */
+    Stats.rx_err_drop++;
+  }
+
+  return (0U);
+}
+
+#if (EMAC_RX_CLASS_CNT > 0U)
+/**
+  \fn          uint32_t RxClassify (const uint8_t *frame, uint32_t len)
+  \brief       Get priority class of received frame from classification rules.
+  \param[in]   frame  Pointer to frame data
+  \param[in]   len    Frame length in bytes
+  \return      class of the first matching rule, 0 when no rule matches
+*/
+static uint32_t RxClassify (const uint8_t *frame, uint32_t len) {
+  const EMAC_RX_RULE *rule;
+  uint32_t type, pcp, tagged;
+  uint32_t i;
+
+  type   = ((uint32_t)frame[12] << 8) | frame[13];
+  tagged = ((type == 0x8100U) && (len >= 18U)) ? 1U : 0U;
+  pcp    = 0U;
+  if (tagged != 0U) {
+    pcp  = (uint32_t)frame[14] >> 5;
+    type = ((uint32_t)frame[16] << 8) | frame[17];
+  }
+
+  for (i = 0U; i < EMAC_RX_RULE_CNT; i++) {
+    rule = &Rx_Rule[i];
+    if (rule->match == 0U) {
+      continue;
+    }
+    if (((rule->match & EMAC_RX_MATCH_ETHERTYPE) != 0U) && (rule->ethertype != type)) {
+      continue;
+    }
+    if (((rule->match & EMAC_RX_MATCH_PCP) != 0U) && ((tagged == 0U) || (pcp < rule->pcp))) {
+      continue;
+    }
+    if (((rule->match & EMAC_RX_MATCH_DST_ADDR) != 0U) && (memcmp (rule->addr, frame, 6U) != 0)) {
+      continue;
+    }
+    return (rule->cls);
+  }
+  return (0U);
+}
+
+/**
+  \fn          void RxClassMove (uint32_t src, uint32_t dst)
+  \brief       Move pending frame into a consumed descriptor, the source descriptor becomes consumed.
+  \param[in]   src  Descriptor index of pending frame
+  \param[in]   dst  Descriptor index of consumed frame
+  \note        Both descriptors are owned by software. Called with interrupts disabled.
+*/
+static void RxClassMove (uint32_t src, uint32_t dst) {
+  volatile enet_rx_bd_struct_t *bd_src = &Rx_Desc[src];
+  volatile enet_rx_bd_struct_t *bd_dst = &Rx_Desc[dst];
+  uint32_t buf, cls, pos, n;
+
+  /* Exchange buffers, frame status moves along with the frame buffer */
+  buf             = bd_dst->buffer;
+  bd_dst->buffer  = bd_src->buffer;
+  bd_src->buffer  = buf;
+  bd_dst->length  = bd_src->length;
+  bd_dst->control = (bd_dst->control & ENET_BUFFDESCRIPTOR_RX_WRAP_MASK) |
+                    (bd_src->control & ~ENET_BUFFDESCRIPTOR_RX_WRAP_MASK);
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+  bd_dst->controlExtend0 = bd_src->controlExtend0;
+  bd_dst->controlExtend1 = bd_src->controlExtend1;
+  bd_dst->timestamp      = bd_src->timestamp;
+#endif
+#if (EMAC_RX_LOAN_CNT > 0U)
+  n            = Rx_Map[dst];
+  Rx_Map[dst]  = Rx_Map[src];
+  Rx_Map[src]  = (uint16_t)n;
+#endif
+#if (EMAC_LATENCY != 0)
+  Rx_Stamp[dst]   = Rx_Stamp[src];
+  Rx_StampOk[dst] = Rx_StampOk[src];
+  Rx_StampOk[src] = 0U;
+#endif
+
+  /* Update class queue entry */
+  cls = Rx_DescCls[src];
+  Rx_DescCls[dst] = (uint8_t)cls;
+  pos = Rx_QHead[cls];
+  for (n = Rx_QCnt[cls]; n != 0U; n--) {
+    if (Rx_Queue[cls][pos] == src) {
+      Rx_Queue[cls][pos] = (uint16_t)dst;
+      break;
+    }
+    if (++pos == EMAC_RX_BUF_CNT) {
+      pos = 0U;
+    }
+  }
+
+  Rx_Done[dst] = 0U;
+  Rx_Done[src] = 1U;
+  Stats.rx_class_move++;
+}
+
+/**
+  \fn          void RxClassRetire (void)
+  \brief       Return consumed descriptors at the head of the receive ring to DMA.
+  \note        A pending frame at the head is moved into a consumed descriptor further in the ring.
+*/
+static void RxClassRetire (void) {
+  uint32_t idx, n;
+
+  for (;;) {
+    while ((Emac.rx_held != 0U) && (Rx_Done[Emac.rx_idx] != 0U)) {
+      Rx_Done[Emac.rx_idx] = 0U;
+      Emac.rx_held--;
+      RxDescRelease (&Rx_Desc[Emac.rx_idx]);
+    }
+    if ((Emac.rx_held < 2U) ||
+        (Emac.rx_cur == (Emac.rx_idx + 1U)) || (Emac.rx_pin == (Emac.rx_idx + 1U))) {
+      /* Nothing held behind the head or head frame is being read */
+      break;
+    }
+
+    /* Find consumed descriptor behind the head */
+    idx = Emac.rx_idx;
+    for (n = Emac.rx_held - 1U; n != 0U; n--) {
+      if (++idx == EMAC_RX_BUF_CNT) {
+        idx = 0U;
+      }
+      if (Rx_Done[idx] != 0U) {
+        break;
+      }
+    }
+    if (n == 0U) {
+      /* All held descriptors contain pending frames */
+      break;
+    }
+    RxClassMove (Emac.rx_idx, idx);
+  }
+}
+
+/**
+  \fn          uint32_t RxClassScan (void)
+  \brief       Classify newly received frames into class queues.
+  \return      bit mask of classes which received frames
+  \note        Called with interrupts disabled.
+*/
+static uint32_t RxClassScan (void) {
+  volatile enet_rx_bd_struct_t *bd;
+  uint32_t idx, cls, pos;
+  uint32_t mask = 0U;
+
+  while (Emac.rx_held < EMAC_RX_BUF_CNT) {
+    idx = Emac.rx_scan;
+    bd  = &Rx_Desc[idx];
+    if ((bd->control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) != 0U) {
+      /* No more frames received */
+      break;
+    }
+    if (++Emac.rx_scan == EMAC_RX_BUF_CNT) {
+      Emac.rx_scan = 0U;
+    }
+    Emac.rx_held++;
+
+    if (RxDescCheck (bd) != 0U) {
+      /* Append descriptor to class queue */
+      cls = RxClassify ((const uint8_t *)bd->buffer + EMAC_RX_OFS, bd->length - EMAC_RX_OFS);
+      pos = Rx_QHead[cls] + Rx_QCnt[cls];
+      if (pos >= EMAC_RX_BUF_CNT) {
+        pos -= EMAC_RX_BUF_CNT;
+      }
+      Rx_Queue[cls][pos] = (uint16_t)idx;
+      Rx_QCnt[cls]++;
+      Rx_DescCls[idx] = (uint8_t)cls;
+      mask |= (1UL << cls);
+    } else {
+      /* Invalid frame */
+      Rx_Done[idx] = 1U;
+    }
+  }
+
+  RxClassRetire ();
+
+  return (mask);
+}
+
+/**
+  \fn          void RxClassRelease (volatile enet_rx_bd_struct_t *bd)
+  \brief       Remove frame from its class queue and return consumed descriptors to DMA.
+  \param[in]   bd  Pointer to receive descriptor returned by RxClassFrame
+*/
+static void RxClassRelease (volatile enet_rx_bd_struct_t *bd) {
+  uint32_t primask;
+  uint32_t idx, cls;
+
+  idx = (uint32_t)(bd - Rx_Desc);
+  cls = Rx_DescCls[idx];
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+
+  /* Descriptor is at the head of its class queue */
+  if (++Rx_QHead[cls] == EMAC_RX_BUF_CNT) {
+    Rx_QHead[cls] = 0U;
+  }
+  Rx_QCnt[cls]--;
+  if (Emac.rx_cur == (idx + 1U)) {
+    Emac.rx_cur = 0U;
+  }
+  if (Emac.rx_pin == (idx + 1U)) {
+    Emac.rx_pin = 0U;
+  }
+
+  Rx_Done[idx] = 1U;
+  RxClassRetire ();
+
+  __set_PRIMASK (primask);
+}
+
+/**
+  \fn          volatile enet_rx_bd_struct_t *RxClassFrame (uint32_t cls)
+  \brief       Get receive descriptor of the next frame in the highest priority (or given) class.
+  \param[in]   cls  Class number or EMAC_RX_CLASS_CNT for highest priority class with pending frames
+  \return      pointer to receive descriptor or NULL when no frame is available
+*/
+static volatile enet_rx_bd_struct_t *RxClassFrame (uint32_t cls) {
+  volatile enet_rx_bd_struct_t *bd;
+  uint32_t primask;
+  uint32_t c, sel;
+
+  for (;;) {
+    bd  = NULL;
+    sel = 0U;
+
+    primask = __get_PRIMASK ();
+    __disable_irq ();
+
+    if ((cls == EMAC_RX_CLASS_CNT) && (Emac.rx_cur != 0U)) {
+      /* Frame already selected (e.g. by GetRxFrameSize) */
+      bd  = &Rx_Desc[Emac.rx_cur - 1U];
+      sel = 1U;
+    } else {
+      RxClassScan ();
+      for (c = EMAC_RX_CLASS_CNT; c != 0U; c--) {
+        if (((cls == EMAC_RX_CLASS_CNT) || (cls == (c - 1U))) && (Rx_QCnt[c - 1U] != 0U)) {
+          bd = &Rx_Desc[Rx_Queue[c - 1U][Rx_QHead[c - 1U]]];
+          break;
+        }
+      }
+      if ((bd != NULL) && (cls == EMAC_RX_CLASS_CNT)) {
+        Emac.rx_cur = (uint16_t)((bd - Rx_Desc) + 1);
+      }
+    }
+    if (bd != NULL) {
+      /* Frame is being read, keep it in its descriptor */
+      Emac.rx_pin = (uint16_t)((bd - Rx_Desc) + 1);
+    }
+
+    __set_PRIMASK (primask);
+
+#if (EMAC_RX_CHECKSUM_SW != 0)
+    /* Software checksum is verified here with interrupts enabled, not in RxClassScan */
+    if ((bd != NULL) && (sel == 0U) && (Emac.rx_csum != 0U) &&
+        (EMAC_ChecksumVerifyFrame ((const uint8_t *)bd->buffer + EMAC_RX_OFS, bd->length - EMAC_RX_OFS) == 0U)) {
+      /* IP header or protocol checksum error */
+      Stats.rx_csum_drop++;
+      RxClassRelease (bd);
+      continue;
+    }
+#else
+    (void)sel;
+#endif
+    break;
+  }
+
+  return (bd);
+}
+#endif
+
+#if (EMAC_RX_SLAB_CNT > 0U)
+/**
+  \fn          void RxSlabFill (void)
+  \brief       Copy small frames at the receive ring head into slabs and re-arm their descriptors.
+  \note        Called from ENET interrupt or from event thread with ENET interrupt masked. Copying stops at a
+               frame larger than EMAC_RX_SLAB_SIZE, when no slab is free and while a reader holds the ring head,
+               so frames are read in receive order.
+*/
+static void RxSlabFill (void) {
+  volatile enet_rx_bd_struct_t *bd;
+  enet_rx_bd_struct_t *sd;
+  uint32_t primask;
+  uint32_t idx, put;
+
+  for (;;) {
+    bd = &Rx_Desc[Emac.rx_idx];
+    if ((Emac.rx_own != 0U) || (Rx_SlabCnt == 0U) ||
+        ((bd->control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) != 0U) || (bd->length > EMAC_RX_SLAB_SIZE)) {
+      break;
+    }
+    if (RxDescCheck (bd) == 0U) {
+      /* Release invalid frame */
+      RxDescRelease (bd);
+      continue;
+    }
+
+    primask = __get_PRIMASK ();
+    __disable_irq ();
+    idx = Rx_SlabFree[--Rx_SlabCnt];
+    __set_PRIMASK (primask);
+
+    /* Copy frame (keeping the alignment offset) and its status */
+    memcpy (&Rx_Slab[idx][0], (const void *)bd->buffer, bd->length);
+    sd          = &Rx_SlabDesc[idx];
+    sd->buffer  = (uint32_t)&Rx_Slab[idx][0];
+    sd->length  = bd->length;
+    sd->control = bd->control;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    sd->controlExtend0 = bd->controlExtend0;
+    sd->controlExtend1 = bd->controlExtend1;
+    sd->timestamp      = bd->timestamp;
+#endif
+#if (EMAC_LATENCY != 0)
+    Rx_SlabStamp[idx]   = Rx_Stamp[Emac.rx_idx];
+    Rx_SlabStampOk[idx] = Rx_StampOk[Emac.rx_idx];
+#endif
+
+    /* Append to slab queue, re-arm descriptor with the same buffer */
+    primask = __get_PRIMASK ();
+    __disable_irq ();
+    put = Emac.slab_get + Emac.slab_qcnt;
+    if (put >= EMAC_RX_SLAB_CNT) {
+      put -= EMAC_RX_SLAB_CNT;
+    }
+    Rx_SlabQ[put] = (uint16_t)idx;
+    Emac.slab_qcnt++;
+    __set_PRIMASK (primask);
+    RxDescRelease (bd);
+  }
+}
+#endif
+
+/**
+  \fn          volatile enet_rx_bd_struct_t *RxDescFrame (void)
+  \brief       Get receive descriptor of the next valid frame, discard invalid frames.
+  \return      pointer to receive descriptor or NULL when no frame is available
+*/
+static volatile enet_rx_bd_struct_t *RxDescFrame (void) {
+#if (EMAC_RX_CLASS_CNT > 0U)
+  /* Strict priority: frame from the highest class with pending frames */
+  return (RxClassFrame (EMAC_RX_CLASS_CNT));
+#else
+  volatile enet_rx_bd_struct_t *bd;
+#if (EMAC_RX_SLAB_CNT > 0U)
+  uint32_t primask;
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  if (Emac.slab_qcnt != 0U) {
+    /* Frames copied into slabs precede the frames in the receive ring */
+    bd = &Rx_SlabDesc[Rx_SlabQ[Emac.slab_get]];
+    __set_PRIMASK (primask);
+    return (bd);
+  }
+  /* Receive ring head is read here, the receive interrupt must not copy it */
+  Emac.rx_own = 1U;
+  __set_PRIMASK (primask);
+#endif
+
+  for (;;) {
+    bd = &Rx_Desc[Emac.rx_idx];
+
+    if ((bd->control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) != 0U) {
+      /* No frame received */
+#if (EMAC_RX_SLAB_CNT > 0U)
+      Emac.rx_own = 0U;
+#endif
+      return (NULL);
+    }
+
+    if (RxDescCheck (bd) != 0U) {
+      return (bd);
+    }
+
+    /* Release invalid frame */
+    RxDescRelease (bd);
+  }
+#endif
+}
+
+/**
+  \fn          void RxFrameReturn (volatile enet_rx_bd_struct_t *bd)
+  \brief       Return receive descriptor returned by RxDescFrame to DMA.
+  \param[in]   bd  Pointer to receive descriptor
+*/
+static void RxFrameReturn (volatile enet_rx_bd_struct_t *bd) {
+#if (EMAC_RX_CLASS_CNT > 0U)
+  RxClassRelease (bd);
+#elif (EMAC_RX_SLAB_CNT > 0U)
+  if ((bd >= Rx_SlabDesc) && (bd < &Rx_SlabDesc[EMAC_RX_SLAB_CNT])) {
+    /* Frame copied into slab, slab is free */
+    RxSlabDequeue (0U);
+    return;
+  }
+  RxDescRelease (bd);
+  Emac.rx_own = 0U;
+#else
+  RxDescRelease (bd);
+#endif
+}
+
+/**
+  \fn          void RxFrameRelease (volatile enet_rx_bd_struct_t *bd)
+  \brief       Release receive descriptor returned by RxDescFrame after the frame was read.
+  \param[in]   bd  Pointer to receive descriptor
+*/
+static void RxFrameRelease (volatile enet_rx_bd_struct_t *bd) {
+#if (EMAC_LATENCY != 0)
+  LatencyRxRead (bd);
+#endif
+#if (EMAC_CAPTURE_SIZE > 0U)
+  if (Emac.cap_on != 0U) {
+    CaptureFrame (EMAC_CAP_RX, (const uint8_t *)bd->buffer + EMAC_RX_OFS, bd->length - EMAC_RX_OFS);
+  }
+#endif
+  RxFrameReturn (bd);
+}
+
+/**
+  \fn          uint32_t RxFramePending (void)
+  \brief       Check if received frames are pending.
+  \return      1 = frames pending, 0 = receive ring drained
+*/
+static uint32_t RxFramePending (void) {
+#if (EMAC_RX_CLASS_CNT > 0U)
+  uint32_t c;
+
+  for (c = 0U; c < EMAC_RX_CLASS_CNT; c++) {
+    if (Rx_QCnt[c] != 0U) {
+      return (1U);
+    }
+  }
+  if ((Emac.rx_held == EMAC_RX_BUF_CNT) ||
+      ((Rx_Desc[Emac.rx_scan].control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) == 0U)) {
+    return (1U);
+  }
+  return (0U);
+#else
+#if (EMAC_RX_SLAB_CNT > 0U)
+  if (Emac.slab_qcnt != 0U) {
+    return (1U);
+  }
+#endif
+  return (((Rx_Desc[Emac.rx_idx].control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) == 0U) ? 1U : 0U);
+#endif
+}
+
+#if (EMAC_TIMESTAMP != 0)
+/**
+  \fn          void PtpSetRate (uint32_t factor)
+  \brief       Set 1588 timer rate.
+  \param[in]   factor  Rate correction factor in Q31 format (0x80000000 = nominal rate)
+  \note        The timer advances by an integer nominal increment per clock cycle. The offset of the
+               requested rate (and of a clock period which is not a whole number of nanoseconds) is
+               corrected by adding or removing nanoseconds every correction period, as in Linux fec_ptp.
+*/
+static void PtpSetRate (uint32_t factor) {
+  uint64_t rate, lhs, rhs;
+  uint32_t clk, inc, corr_inc, period;
+  int64_t  ppb;
+  uint8_t  neg;
+
+  clk = (EMAC_PTP_CLOCK != 0U) ? EMAC_PTP_CLOCK : Emac.pclk;
+
+  /* Nominal timer increment rounded to nanoseconds */
+  inc = (1000000000U + (clk / 2U)) / clk;
+
+  /* Frequency offset of the nominal increment to the requested rate in ppb */
+  rate = ((uint64_t)factor * 1000000000U) >> 31;
+  ppb  = (int64_t)((rate * 1000000000U) / ((uint64_t)inc * clk)) - 1000000000;
+
+  neg = 0U;
+  if (ppb < 0) {
+    neg = 1U;
+    ppb = -ppb;
+  }
+
+  corr_inc = 0U;
+  period   = 0U;
+  if (ppb != 0) {
+    /* Find the smallest correction step with corr_inc / period = ppb / 10^9 */
+    lhs = 1000000000U;
+    rhs = (uint64_t)ppb * inc;
+    for (corr_inc = 1U; corr_inc <= inc; corr_inc++) {
+      if (lhs >= rhs) {
+        break;
+      }
+      lhs += 1000000000U;
+    }
+    if (corr_inc > inc) {
+      /* Offset too large, correct on every clock cycle */
+      corr_inc = inc;
+      period   = 1U;
+    } else {
+      lhs /= rhs;
+      period = (lhs > ENET_ATCOR_COR_MASK) ? 0U : (uint32_t)lhs;
+    }
+  }
+
+  if (period == 0U) {
+    /* No correction required */
+    corr_inc = 0U;
+  }
+  if (neg != 0U) {
+    corr_inc = inc - corr_inc;
+  } else {
+    corr_inc = inc + corr_inc;
+  }
+
+  ENET->ATINC = ENET_ATINC_INC(inc) | ENET_ATINC_INC_CORR(corr_inc);
+  ENET->ATCOR = ENET_ATCOR_COR(period);
+}
+
+#if (EMAC_PTP_ALARM != 0)
+/**
+  \fn          void PtpAlarmArm (void)
+  \brief       Arm compare channel for the timer alarm.
+  \note        The compare channel matches nanoseconds only, it is armed in the alarm second.
+               Called from 1588 timer interrupt or with interrupts disabled.
+*/
+static void PtpAlarmArm (void) {
+  enet_ptp_time_t t;
+
+  if (ENET_Ptp1588GetChannelStatus (ENET, EMAC_ALARM_CHANNEL)) {
+    /* Compare event pending, signaled by 1588 timer interrupt */
+    return;
+  }
+  ENET_Ptp1588SetChannelMode (ENET, EMAC_ALARM_CHANNEL, kENET_PtpChannelDisable, false);
+
+  if (Emac.alarm == 0U) {
+    return;
+  }
+
+  ENET_Ptp1588GetTimer (ENET, &Emac.h, &t);
+  if ((uint32_t)t.second == Emac.alarm_sec) {
+    /* Alarm expires in current second */
+    ENET_Ptp1588SetChannelCmpValue (ENET, EMAC_ALARM_CHANNEL, Emac.alarm_ns);
+    ENET_Ptp1588SetChannelMode (ENET, EMAC_ALARM_CHANNEL, kENET_PtpChannelSoftCompare, true);
+    ENET_Ptp1588GetTimer (ENET, &Emac.h, &t);
+    if (ENET_Ptp1588GetChannelStatus (ENET, EMAC_ALARM_CHANNEL)) {
+      return;
+    }
+  }
+
+  if (((uint32_t)t.second > Emac.alarm_sec) ||
+      (((uint32_t)t.second == Emac.alarm_sec) && (t.nanosecond >= Emac.alarm_ns))) {
+    /* Alarm time passed before the compare channel was armed */
+    ENET_Ptp1588SetChannelMode (ENET, EMAC_ALARM_CHANNEL, kENET_PtpChannelDisable, false);
+    Emac.alarm = 0U;
+    SignalEvent (ARM_ETH_MAC_EVENT_TIMER_ALARM);
+  }
+}
+#endif
+
+/**
+  \fn          void PtpTimeConvert (uint32_t ns, ARM_ETH_MAC_TIME *time)
+  \brief       Extend captured nanoseconds timestamp with the seconds counter.
+  \param[in]   ns    Captured timestamp (nanoseconds)
+  \param[out]  time  Pointer to time structure
+*/
+static void PtpTimeConvert (uint32_t ns, ARM_ETH_MAC_TIME *time) {
+  enet_ptp_time_t now;
+
+  ENET_Ptp1588GetTimer (ENET, &Emac.h, &now);
+
+  time->sec = (uint32_t)now.second;
+  if (ns > now.nanosecond) {
+    /* Captured before the last seconds counter increment */
+    time->sec--;
+  }
+  time->ns = ns;
+}
+#endif
+
+#if (EMAC_PHY_CACHE_REGS != 0U)
+/**
+  \fn          uint32_t PhyCacheRead (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data)
+  \brief       Read PHY register from PHY register cache.
+  \param[in]   phy_addr  5-bit device address
+  \param[in]   reg_addr  5-bit register address
+  \param[out]  data      Pointer where the result is written to
+  \return      1 = cache hit, 0 = cache miss
+*/
+static uint32_t PhyCacheRead (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
+
+  if ((phy_addr == Emac.phy_addr) && ((Emac.phy_valid & (1UL << reg_addr)) != 0U)) {
+    *data = Phy_Cache[reg_addr];
+    return (1U);
+  }
+  return (0U);
+}
+
+/**
+  \fn          void PhyCacheUpdate (uint8_t phy_addr, uint8_t reg_addr, uint16_t data)
+  \brief       Update PHY register cache.
+  \param[in]   phy_addr  5-bit device address
+  \param[in]   reg_addr  5-bit register address
+  \param[in]   data      Register value
+*/
+static void PhyCacheUpdate (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
+
+  if ((EMAC_PHY_CACHE_REGS & (1UL << reg_addr)) == 0U) {
+    /* Register not cacheable */
+    return;
+  }
+  if (phy_addr != Emac.phy_addr) {
+    /* Cache registers of a different PHY */
+    Emac.phy_addr  = phy_addr;
+    Emac.phy_valid = 0U;
+  }
+  Phy_Cache[reg_addr] = data;
+  Emac.phy_valid     |= (1UL << reg_addr);
+}
+#endif
+
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+#if (EMAC_LINK_MONITOR != 0)
+static void LinkRead (void);
+#endif
+
+/**
+  \fn          void MdioStart (void)
+  \brief       Start MDIO transaction at the head of the queue.
+*/
+static void MdioStart (void) {
+  EMAC_MDIO_XFER *xfer = Mdio_Queue[Emac.mdio_get];
+
+  ENET_ClearInterruptStatus (ENET, kENET_MiiInterrupt);
+  EnetIrqEnable (kENET_MiiInterrupt);
+
+  if (xfer->write != 0U) {
+    ENET_StartSMIWrite (ENET, xfer->phy_addr, xfer->reg_addr, kENET_MiiWriteValidFrame, xfer->data);
+  } else {
+    ENET_StartSMIRead (ENET, xfer->phy_addr, xfer->reg_addr, kENET_MiiReadValidFrame);
+  }
+}
+
+/**
+  \fn          void MdioComplete (void)
+  \brief       Complete MDIO transaction at the head of the queue and start the next one.
+  \note        Called from ENET interrupt or with interrupts disabled.
+*/
+static void MdioComplete (void) {
+  EMAC_MDIO_XFER *xfer = Mdio_Queue[Emac.mdio_get];
+
+  ENET_ClearInterruptStatus (ENET, kENET_MiiInterrupt);
+
+  if (xfer->write == 0U) {
+    xfer->data = (uint16_t)ENET_ReadSMIData (ENET);
+  }
+#if (EMAC_PHY_CACHE_REGS != 0U)
+  PhyCacheUpdate (xfer->phy_addr, xfer->reg_addr, xfer->data);
+#endif
+
+  if (++Emac.mdio_get == EMAC_MDIO_QUEUE_LEN) {
+    Emac.mdio_get = 0U;
+  }
+  Emac.mdio_cnt--;
+
+  if (Emac.mdio_cnt != 0U) {
+    MdioStart ();
+  } else {
+    EnetIrqDisable (kENET_MiiInterrupt);
+  }
+
+  xfer->status = EMAC_MDIO_DONE;
+  if (xfer->cb_done != NULL) {
+    xfer->cb_done (xfer);
+  }
+
+#if (EMAC_LINK_MONITOR != 0)
+  if (Emac.link_retry != 0U) {
+    /* Link monitor read was rejected by full queue */
+    Emac.link_retry = 0U;
+    LinkRead ();
+  }
+#endif
+}
+
+/**
+  \fn          void MdioAbort (void)
+  \brief       Abort all queued MDIO transactions.
+  \note        Called with interrupts disabled.
+*/
+static void MdioAbort (void) {
+  EMAC_MDIO_XFER *xfer;
+
+  EnetIrqDisable (kENET_MiiInterrupt);
+
+  while (Emac.mdio_cnt != 0U) {
+    xfer = Mdio_Queue[Emac.mdio_get];
+    if (++Emac.mdio_get == EMAC_MDIO_QUEUE_LEN) {
+      Emac.mdio_get = 0U;
+    }
+    Emac.mdio_cnt--;
+
+    xfer->status = EMAC_MDIO_ERROR;
+    if (xfer->cb_done != NULL) {
+      xfer->cb_done (xfer);
+    }
+  }
+}
+
+#if (EMAC_EVENT_THREAD != 0)
+/**
+  \fn          void MdioWake (EMAC_MDIO_XFER *xfer)
+  \brief       PHY_Read/PHY_Write transaction completed: wake waiting thread.
+  \param[in]   xfer  Pointer to MDIO transaction
+*/
+static void MdioWake (EMAC_MDIO_XFER *xfer) {
+  (void)osThreadFlagsSet (((MDIO_WAIT *)xfer)->thread, EMAC_MDIO_THREAD_FLAG);
+}
+#endif
+
+/**
+  \fn          int32_t MdioTransfer (MDIO_WAIT *wait)
+  \brief       Queue MDIO transaction and wait for completion.
+  \param[in]   wait  Pointer to transaction (phy_addr, reg_addr, write and data set by caller)
+  \return      \ref execution_status
+  \note        With EMAC_EVENT_THREAD a calling thread blocks on thread flag EMAC_MDIO_THREAD_FLAG.
+               Otherwise, and from interrupts or with interrupts disabled, the function polls.
+*/
+static int32_t MdioTransfer (MDIO_WAIT *wait) {
+  EMAC_MDIO_XFER *xfer = &wait->xfer;
+  uint32_t primask;
+  uint32_t loop;
+  int32_t  rval;
+
+  xfer->cb_done = NULL;
+#if (EMAC_EVENT_THREAD != 0)
+  wait->thread  = NULL;
+  if ((__get_IPSR () == 0U) && (__get_PRIMASK () == 0U) && (osKernelGetState () == osKernelRunning)) {
+    /* Thread context: completion wakes the thread */
+    wait->thread  = osThreadGetId ();
+    xfer->cb_done = MdioWake;
+  }
+#endif
+
+  rval = EMAC_MDIO_Submit (xfer);
+  if (rval != ARM_DRIVER_OK) {
+    return (rval);
+  }
+
+#if (EMAC_EVENT_THREAD != 0)
+  if (wait->thread != NULL) {
+    while (xfer->status == EMAC_MDIO_PENDING) {
+      /* MDIO frame takes about 30 us, time out after 10 ms */
+      if ((osThreadFlagsWait (EMAC_MDIO_THREAD_FLAG, osFlagsWaitAny,
+                              (osKernelGetTickFreq () / 100U) + 1U) & osFlagsError) != 0U) {
+        primask = __get_PRIMASK ();
+        __disable_irq ();
+        if (xfer->status == EMAC_MDIO_PENDING) {
+          /* Timeout, abort queued transactions */
+          MdioAbort ();
+        }
+        __set_PRIMASK (primask);
+      }
+    }
+    /* Flag set when completed before the wait (cached register) or on abort */
+    (void)osThreadFlagsClear (EMAC_MDIO_THREAD_FLAG);
+    return ((xfer->status == EMAC_MDIO_DONE) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR);
+  }
+#endif
+
+  /* Synchronous path (no RTOS, interrupt context or interrupts disabled) */
+  loop = SystemCoreClock;
+  while (xfer->status == EMAC_MDIO_PENDING) {
+    if ((ENET_GetInterruptStatus (ENET) & kENET_MiiInterrupt) != 0U) {
+      /* MDIO frame done but ENET interrupt not taken (masked): complete transaction here */
+      primask = __get_PRIMASK ();
+      __disable_irq ();
+      if ((Emac.mdio_cnt != 0U) && ((ENET_GetInterruptStatus (ENET) & kENET_MiiInterrupt) != 0U)) {
+        MdioComplete ();
+      }
+      __set_PRIMASK (primask);
+    }
+    loop--;
+    if (loop == 0U) {
+      primask = __get_PRIMASK ();
+      __disable_irq ();
+      if (xfer->status == EMAC_MDIO_PENDING) {
+        /* Loop counter timeout, abort queued transactions */
+        MdioAbort ();
+      }
+      __set_PRIMASK (primask);
+    }
+  }
+
+  return ((xfer->status == EMAC_MDIO_DONE) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR);
+}
+#endif
+
+/**
+  \fn          void EnetInit (void)
+  \brief       Initialize ENET peripheral and restore driver state.
+*/
+static void EnetInit (void) {
+#if (EMAC_TIMESTAMP != 0)
+  enet_ptp_config_t ptp_cfg;
+#endif
+
+  if ((Emac.flags & EMAC_FLAG_POWER) != 0U) {
+    /* Collect MIB counters before peripheral reset */
+    StatsUpdate (0U);
+  }
+
+  ENET_Init (ENET, &Emac.h, &Emac.cfg, &Emac.desc_cfg, Emac.addr, Emac.pclk);
+  RingInit ();
+  FlowApply ();
+#if (EMAC_UCAST_CNT > 0U)
+  UcastApply ();
+#endif
+
+  /* Enable MIB counters */
+  ENET->MIBC &= ~ENET_MIBC_MIB_DIS_MASK;
+  StatsUpdate (1U);
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  if (Emac.mdio_cnt != 0U) {
+    /* Restart MDIO transaction interrupted by peripheral reset */
+    MdioStart ();
+  }
+#endif
+#if (EMAC_COALESCE != 0)
+  CoalesceApply ();
+#endif
+
+#if (EMAC_TIMESTAMP != 0)
+  /* Start 1588 timer */
+  ptp_cfg.channel            = kENET_PtpTimerChannel1;
+  ptp_cfg.ptp1588ClockSrc_Hz = (EMAC_PTP_CLOCK != 0U) ? EMAC_PTP_CLOCK : Emac.pclk;
+  ENET_Ptp1588Configure (ENET, &Emac.h, &ptp_cfg);
+  PtpSetRate (0x80000000U);
+#if (EMAC_PTP_ALARM != 0)
+  PtpAlarmArm ();
+#endif
+#endif
+}
+
+/**
+  \fn          void TxRebase (uint32_t flush)
+  \brief       Move frames not yet sent to the start of the transmit ring after the MAC was disabled.
+  \param[in]   flush  0 = retain frames not yet sent, 1 = discard them
+  \note        Called with interrupts disabled and transmit stopped.
+*/
+static void TxRebase (uint32_t flush) {
+  uint32_t i;
+#if (EMAC_TX_ZERO_COPY == 0)
+
+  if (flush != 0U) {
+    /* Discard frames in transmission, queued frames and a partially assembled frame */
+    Emac.tx_dcnt = 0U;
+    Emac.tx_qcnt = 0U;
+    Emac.tx_sub  = Emac.tx_put;
+    Emac.tx_len  = 0U;
+#if (EMAC_TIMESTAMP != 0)
+    Emac.tx_ts   = 0U;
+#endif
+  }
+
+  /* Reclaim sent frames and put frames not yet sent back into the transmit queue */
+  if ((Emac.tx_ts != 0U) && (Emac.tx_ts_idx < EMAC_TX_BUF_CNT)) {
+    if ((Tx_Desc[Emac.tx_ts_idx].control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0U) {
+      /* Timestamped frame requeued */
+      Emac.tx_ts_idx = EMAC_TX_BUF_CNT;
+    } else {
+      Emac.tx_ts = 0U;
+    }
+  }
+  TxReclaim ();
+  Emac.tx_sub   = (Emac.tx_sub + EMAC_TX_SLOT_CNT - Emac.tx_dcnt) % EMAC_TX_SLOT_CNT;
+  Emac.tx_qcnt += Emac.tx_dcnt;
+  Emac.tx_dcnt  = 0U;
+  for (i = 0U; i < EMAC_TX_BUF_CNT; i++) {
+    Tx_Desc[i].control &= ENET_BUFFDESCRIPTOR_TX_WRAP_MASK;
+  }
+  Emac.tx_idx   = 0U;
+  Emac.tx_cidx  = 0U;
+#else
+  enet_tx_bd_struct_t bd[EMAC_TX_BUF_CNT];
+  uint32_t idx, n, ts;
+
+  if (flush != 0U) {
+    /* Discard frames not yet sent and fragments of a frame not yet handed over */
+    for (i = 0U; i < EMAC_TX_BUF_CNT; i++) {
+      Tx_Desc[i].control &= ~ENET_BUFFDESCRIPTOR_TX_READY_MASK;
+    }
+    Emac.tx_frag = 0U;
+    Emac.tx_ts   = 0U;
+  }
+
+  /* Frames not yet sent end at tx_idx, collect them oldest first */
+  ts  = ((Emac.tx_ts != 0U) && (Emac.tx_ts_idx >= EMAC_TX_BUF_CNT)) ? (EMAC_TX_BUF_CNT + 1U) : 0U;
+  n   = 0U;
+  idx = Emac.tx_idx;
+  for (i = 0U; i < EMAC_TX_BUF_CNT; i++) {
+    if ((Tx_Desc[idx].control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0U) {
+      if ((Emac.tx_ts != 0U) && (Emac.tx_ts_idx == idx)) {
+        ts = n + 1U;
+      }
+      bd[n++] = Tx_Desc[idx];
+    }
+    if (++idx == EMAC_TX_BUF_CNT) {
+      idx = 0U;
+    }
+  }
+
+  for (i = 0U; i < EMAC_TX_BUF_CNT; i++) {
+    if (i < n) {
+      Tx_Desc[i].buffer = bd[i].buffer;
+      Tx_Desc[i].length = bd[i].length;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+      Tx_Desc[i].controlExtend1 = bd[i].controlExtend1;
+#endif
+      Tx_Desc[i].control = (Tx_Desc[i].control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK) |
+                           (bd[i].control & ~ENET_BUFFDESCRIPTOR_TX_WRAP_MASK);
+    } else {
+      Tx_Desc[i].control &= ENET_BUFFDESCRIPTOR_TX_WRAP_MASK;
+    }
+  }
+  Emac.tx_idx   = (uint16_t)(n % EMAC_TX_BUF_CNT);
+  Emac.tx_ts    = (ts != 0U) ? 1U : 0U;
+  Emac.tx_ts_idx = (uint16_t)((ts != 0U) ? (ts - 1U) : 0U);
+#endif
+  Emac.tx_first = 0U;
+}
+
+/**
+  \fn          uint32_t EnetTxStop (void)
+  \brief       Gracefully stop transmit: frame in progress completes, following descriptors are kept.
+  \return      1 = transmit stopped, 0 = timeout (transmit not stopped)
+*/
+static uint32_t EnetTxStop (void) {
+  uint32_t loop;
+
+  ENET->EIR  = ENET_EIR_GRA_MASK;
+  ENET->TCR |= ENET_TCR_GTS_MASK;
+  loop = SystemCoreClock / 50U;
+  while ((ENET->EIR & ENET_EIR_GRA_MASK) == 0U) {
+    if (--loop == 0U) {
+      ENET->TCR &= ~ENET_TCR_GTS_MASK;
+      return (0U);
+    }
+  }
+  ENET->EIR = ENET_EIR_GRA_MASK;
+
+  return (1U);
+}
+
+/**
+  \fn          void EnetRestart (uint32_t tx_flush)
+  \brief       Rebase receive and transmit rings after the MAC was disabled and enable the MAC.
+  \param[in]   tx_flush  0 = retain frames not yet sent, 1 = discard them
+  \note        Called with interrupts disabled. Frames not yet read are discarded.
+*/
+static void EnetRestart (uint32_t tx_flush) {
+  uint32_t i;
+
+  /* Rebase receive ring, frames not yet read are discarded */
+  for (i = 0U; i < EMAC_RX_BUF_CNT; i++) {
+    Rx_Desc[i].control = (Rx_Desc[i].control & ENET_BUFFDESCRIPTOR_RX_WRAP_MASK) | ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK;
+  }
+  Emac.rx_idx  = 0U;
+  Emac.rx_skip = 0U;
+#if (EMAC_RX_CLASS_CNT > 0U)
+  RxClassReset ();
+#endif
+#if (EMAC_RX_SLAB_CNT > 0U)
+  RxSlabReset ();
+#endif
+
+  /* Rebase transmit ring */
+  TxRebase (tx_flush);
+#if (EMAC_LATENCY != 0)
+  memset (Rx_StampOk, 0, sizeof(Rx_StampOk));
+  memset (Tx_StampOk, 0, sizeof(Tx_StampOk));
+  Emac.lat_rx_idx = 0U;
+  Emac.lat_tx_idx = 0U;
+#endif
+
+  /* Enable MAC and restart receive and transmit */
+  ENET->ECR |= ENET_ECR_ETHEREN_MASK;
+  ENET_ActiveRead (ENET);
+#if (EMAC_TX_ZERO_COPY == 0)
+  TxSubmit ();
+#else
+  if ((Tx_Desc[0].control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0U) {
+    /* Resume frames not yet sent */
+    ENET->TDAR = ENET_TDAR_TDAR_MASK;
+  }
+#endif
+}
+
+/**
+  \fn          uint32_t EnetReconfigure (void)
+  \brief       Apply link and filter configuration without ENET peripheral re-initialization.
+  \return      1 = configuration applied, 0 = peripheral must be re-initialized
+*/
+static uint32_t EnetReconfigure (void) {
+  uint32_t rcr, tcr;
+  uint32_t primask;
+
+  rcr = ENET->RCR & ~(ENET_RCR_PROM_MASK | ENET_RCR_BC_REJ_MASK | ENET_RCR_RMII_10T_MASK | ENET_RCR_DRT_MASK);
+  if ((Emac.cfg.macSpecialConfig & kENET_ControlPromiscuousEnable) != 0U) {
+    rcr |= ENET_RCR_PROM_MASK;
+  }
+  if ((Emac.cfg.macSpecialConfig & kENET_ControlRxBroadCastRejectEnable) != 0U) {
+    rcr |= ENET_RCR_BC_REJ_MASK;
+  }
+  if ((Emac.cfg.miiMode == kENET_RmiiMode) && (Emac.cfg.miiSpeed == kENET_MiiSpeed10M)) {
+    rcr |= ENET_RCR_RMII_10T_MASK;
+  }
+  if (Emac.cfg.miiDuplex == kENET_MiiHalfDuplex) {
+    rcr |= ENET_RCR_DRT_MASK;
+  }
+
+  tcr = ENET->TCR & ~ENET_TCR_FDEN_MASK;
+  if (Emac.cfg.miiDuplex == kENET_MiiFullDuplex) {
+    tcr |= ENET_TCR_FDEN_MASK;
+  }
+
+  if ((((ENET->RCR ^ rcr) & (ENET_RCR_RMII_10T_MASK | ENET_RCR_DRT_MASK)) == 0U) && (ENET->TCR == tcr) &&
+      (ENET->RACC == Emac.cfg.rxAccelerConfig) && (ENET->TACC == Emac.cfg.txAccelerConfig)) {
+    /* Only address filter changed, update receive control on the fly */
+    ENET->RCR = rcr;
+    return (1U);
+  }
+
+#if (EMAC_TX_ZERO_COPY != 0)
+  if (Emac.tx_frag != 0U) {
+    /* Frame fragments pending in transmit descriptors */
+    return (0U);
+  }
+#endif
+
+  if (EnetTxStop () == 0U) {
+    return (0U);
+  }
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+
+  /* Disable MAC, this also resets DMA descriptor pointers to the ring start */
+  ENET->ECR &= ~ENET_ECR_ETHEREN_MASK;
+
+  ENET->RCR  = rcr;
+  ENET->TCR  = tcr;
+  ENET->RACC = Emac.cfg.rxAccelerConfig;
+  ENET->TACC = Emac.cfg.txAccelerConfig;
+
+  /* Rebase rings, frames not yet sent are retained */
+  EnetRestart (0U);
+
+  __set_PRIMASK (primask);
+
+  return (1U);
+}
+
+#if (EMAC_LINK_MONITOR != 0)
+/**
+  \fn          void LinkUpdate (void)
+  \brief       Evaluate PHY status registers, reconfigure MAC and signal link change.
+*/
+static void LinkUpdate (void) {
+  uint32_t state, speed, duplex, ability;
+
+  speed  = Emac.link_speed;
+  duplex = Emac.link_duplex;
+
+  if ((Link_Reg[1] & 0x0004U) != 0U) {
+    /* Link up */
+    state = ARM_ETH_LINK_UP;
+    if ((Link_Reg[1] & 0x0020U) != 0U) {
+      /* Auto-negotiation complete, select highest common ability */
+      ability = Link_Reg[2] & Link_Reg[3];
+      if ((ability & 0x0100U) != 0U) {
+        speed = ARM_ETH_SPEED_100M; duplex = ARM_ETH_DUPLEX_FULL;
+      } else if ((ability & 0x0080U) != 0U) {
+        speed = ARM_ETH_SPEED_100M; duplex = ARM_ETH_DUPLEX_HALF;
+      } else if ((ability & 0x0040U) != 0U) {
+        speed = ARM_ETH_SPEED_10M;  duplex = ARM_ETH_DUPLEX_FULL;
+      } else {
+        speed = ARM_ETH_SPEED_10M;  duplex = ARM_ETH_DUPLEX_HALF;
+      }
+    }
+  } else {
+    state = ARM_ETH_LINK_DOWN;
+  }
+
+  if ((state == Emac.link_state) && (speed == Emac.link_speed) && (duplex == Emac.link_duplex)) {
+    /* No change */
+    return;
+  }
+  Emac.link_state  = (uint8_t)state;
+  Emac.link_speed  = (uint8_t)speed;
+  Emac.link_duplex = (uint8_t)duplex;
+
+  if (state == ARM_ETH_LINK_UP) {
+    /* Negotiated speed and duplex mode are applied in thread context (LinkApply) */
+    Emac.link_apply = 1U;
+  }
+
+  SignalEvent (EMAC_EVENT_LINK_CHANGE);
+}
+
+/**
+  \fn          void LinkApply (void)
+  \brief       Apply negotiated link speed and duplex mode to the MAC.
+  \note        Called from thread context after EMAC_EVENT_LINK_CHANGE.
+*/
+static void LinkApply (void) {
+  uint32_t irq;
+
+  if ((Emac.link_apply == 0U) || ((Emac.flags & EMAC_FLAG_POWER) == 0U)) {
+    return;
+  }
+  Emac.link_apply = 0U;
+
+  Emac.cfg.miiSpeed  = (Emac.link_speed  == ARM_ETH_SPEED_10M)   ? kENET_MiiSpeed10M   : kENET_MiiSpeed100M;
+  Emac.cfg.miiDuplex = (Emac.link_duplex == ARM_ETH_DUPLEX_HALF) ? kENET_MiiHalfDuplex : kENET_MiiFullDuplex;
+
+  if (EnetReconfigure () == 0U) {
+    /* Re-initialize peripheral, keep receive and transmit enabled as they were */
+    irq = ENET->EIMR & (kENET_RxFrameInterrupt | kENET_TxFrameInterrupt);
+    if (Emac.rx_polling != 0U) {
+      irq |= kENET_RxFrameInterrupt;
+    }
+    EnetInit ();
+    EnetIrqDisable ((kENET_RxFrameInterrupt | kENET_TxFrameInterrupt) & ~irq);
+  }
+}
+
+/**
+  \fn          void LinkXferDone (EMAC_MDIO_XFER *xfer)
+  \brief       Link monitor MDIO read completed: read next register or evaluate link state.
+  \param[in]   xfer  Pointer to MDIO transaction
+*/
+static void LinkXferDone (EMAC_MDIO_XFER *xfer) {
+
+  if (xfer->status != EMAC_MDIO_DONE) {
+    /* Transaction aborted */
+    Emac.link_busy = 0U;
+    return;
+  }
+
+  Link_Reg[Emac.link_step] = xfer->data;
+  if (++Emac.link_step < 4U) {
+    LinkRead ();
+    return;
+  }
+
+  LinkUpdate ();
+
+  Emac.link_step = 0U;
+  if (Emac.link_pend != 0U) {
+    /* Interrupt received during register read, read again */
+    Emac.link_pend = 0U;
+    LinkRead ();
+  } else {
+    Emac.link_busy = 0U;
+  }
+}
+
+/**
+  \fn          void LinkRead (void)
+  \brief       Queue read of the current link monitor PHY register.
+*/
+static void LinkRead (void) {
+
+  Link_Xfer.phy_addr = Emac.link_phy;
+  Link_Xfer.reg_addr = Link_RegAddr[Emac.link_step];
+  Link_Xfer.write    = 0U;
+  Link_Xfer.data     = 0U;
+  Link_Xfer.cb_done  = LinkXferDone;
+
+  if (EMAC_MDIO_Submit (&Link_Xfer) != ARM_DRIVER_OK) {
+    /* MDIO queue full, retry when the next transaction completes */
+    Emac.link_retry = 1U;
+  }
+}
+
+/**
+  \fn          void LinkSignalEvent (ARM_GPIO_Pin_t pin, uint32_t event)
+  \brief       PHY interrupt line event: start reading PHY status registers.
+  \param[in]   pin    GPIO pin
+  \param[in]   event  GPIO event
+*/
+static void LinkSignalEvent (ARM_GPIO_Pin_t pin, uint32_t event) {
+  uint32_t primask;
+
+  (void)pin;
+  (void)event;
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  if (Emac.link_busy != 0U) {
+    /* Read in progress, repeat when completed */
+    Emac.link_pend = 1U;
+  } else {
+    Emac.link_busy = 1U;
+    Emac.link_step = 0U;
+    LinkRead ();
+  }
+  __set_PRIMASK (primask);
+}
+#endif
+
+/**
+  \fn          ARM_DRIVER_VERSION ARM_ETH_MAC_GetVersion (void)
+  \brief       Get driver version.
+  \return      \ref ARM_DRIVER_VERSION
+*/
+static ARM_DRIVER_VERSION GetVersion (void) {
+  return DriverVersion;
+}
+
+
+/**
+  \fn          ARM_ETH_MAC_CAPABILITIES GetCapabilities (void)
+  \brief       Get driver capabilities.
+  \return      \ref ARM_ETH_MAC_CAPABILITIES
+*/
+static ARM_ETH_MAC_CAPABILITIES GetCapabilities (void) {
+  return DriverCapabilities;
+}
+
+
+/**
+  \fn          int32_t Initialize (ARM_ETH_MAC_SignalEvent_t cb_event)
+  \brief       Initialize Ethernet MAC Device.
+  \param[in]   cb_event  Pointer to \ref ARM_ETH_MAC_SignalEvent
+  \return      \ref execution_status
+*/
+static int32_t Initialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
+#if ((EMAC_RX_LOAN_CNT > 0U) || (EMAC_RX_SLAB_CNT > 0U))
+  uint32_t i;
+#endif
+
+  if (Emac.flags & EMAC_FLAG_INIT) { return ARM_DRIVER_OK; }
+
+  /* Setup Tx/Rx descriptors */
+  Emac.desc_cfg.txBdStartAddrAlign = &Tx_Desc[0];
+#if (EMAC_TX_ZERO_COPY == 0)
+  Emac.desc_cfg.txBufferAlign      = &Tx_Buf[0][0];
+#else
+  Emac.desc_cfg.txBufferAlign      = NULL;          /* Buffers assigned per frame */
+#endif
+  Emac.desc_cfg.txBdNumber         =  EMAC_TX_BUF_CNT;
+  Emac.desc_cfg.txBuffSizeAlign    =  EMAC_BUF_SIZE;
+  Emac.desc_cfg.txMaintainEnable   = true;
+
+  Emac.desc_cfg.rxBdStartAddrAlign = &Rx_Desc[0];
+  Emac.desc_cfg.rxBufferAlign      = &Rx_Buf[0][0];
+  Emac.desc_cfg.rxBdNumber         =  EMAC_RX_BUF_CNT;
+  Emac.desc_cfg.rxBuffSizeAlign    =  EMAC_BUF_SIZE;
+  Emac.desc_cfg.rxMaintainEnable   = true;
+
+#if (EMAC_RX_LOAN_CNT > 0U)
+  /* Setup receive buffer pool */
+  for (i = 0U; i < EMAC_RX_BUF_CNT; i++) {
+    Rx_Map[i] = (uint16_t)i;
+  }
+  for (i = 0U; i < EMAC_RX_LOAN_CNT; i++) {
+    Rx_Spare[i] = (uint16_t)(EMAC_RX_BUF_CNT + i);
+  }
+  Rx_SpareCnt = EMAC_RX_LOAN_CNT;
+  memset (Rx_Loaned, 0, sizeof(Rx_Loaned));
+#endif
+
+#if (EMAC_RX_SLAB_CNT > 0U)
+  /* Setup small frame slab pool */
+  for (i = 0U; i < EMAC_RX_SLAB_CNT; i++) {
+    Rx_SlabFree[i] = (uint16_t)i;
+  }
+  Rx_SlabCnt = EMAC_RX_SLAB_CNT;
+  memset (Rx_SlabUsed, 0, sizeof(Rx_SlabUsed));
+#endif
+
+#if (EMAC_RX_CLASS_CNT > 0U)
+  /* Clear classification rules */
+  memset (Rx_Rule, 0, sizeof(Rx_Rule));
+#endif
+
+#if (EMAC_VLAN_SET != 0)
+  /* Clear VLAN ID set */
+  memset (Vlan_Map, 0, sizeof(Vlan_Map));
+#endif
+  Emac.vlan_flt  = 0U;
+  Emac.vlan_mask = 0U;
+  Emac.vlan_cnt  = 0U;
+#if (EMAC_LINK_MONITOR != 0)
+  Emac.link_busy  = 0U;
+  Emac.link_pend  = 0U;
+  Emac.link_retry = 0U;
+  Emac.link_apply = 0U;
+  Emac.link_state = ARM_ETH_LINK_DOWN;
+#endif
+#if (EMAC_UCAST_CNT > 0U)
+  Emac.uc_flt    = 0U;
+  Emac.uc_cnt    = 0U;
+#endif
+#if (EMAC_MCAST_CNT > 0U)
+  Emac.mc_flt    = 0U;
+  Emac.mc_cnt    = 0U;
+#endif
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  Emac.mdio_get  = 0U;
+  Emac.mdio_cnt  = 0U;
+#endif
+  Emac.rx_poll   = 0U;
+  Emac.rx_csum   = 0U;
+#if (EMAC_CAPTURE_SIZE > 0U)
+  Emac.cap_on    = 0U;
+  memset (Emac.cap, 0, sizeof(Emac.cap));
+#endif
+  Emac.fc_quanta = 0U;
+  Emac.stats_time = 0U;
+  memset (&Stats, 0, sizeof(Stats));
+#if (EMAC_PHY_CACHE_REGS != 0U)
+  Emac.phy_valid = 0U;
+#endif
+
+  /* Get ethernet peripheral clock */
+  Emac.pclk = CLOCK_GetFreq (kCLOCK_IpgClk);
+
+  /* Register driver callback function */
+  Emac.cb_event = cb_event;
+
+#if (EMAC_EVENT_THREAD != 0)
+  Emac.ev_put   = 0U;
+  Emac.ev_get   = 0U;
+  Emac.ev_flags = 0U;
+  if (Emac.ev_thread == NULL) {
+    const osThreadAttr_t attr = {
+      .name       = "EMAC_Event",
+      .stack_size = EMAC_EVENT_THREAD_STACK,
+      .priority   = EMAC_EVENT_THREAD_PRIO
+    };
+    Emac.ev_thread = osThreadNew (EventThread, NULL, &attr);
+    if (Emac.ev_thread == NULL) {
+      return ARM_DRIVER_ERROR;
+    }
+  }
+
+#endif
+
+#if (((EMAC_EVENT_THREAD != 0) || (EMAC_LATENCY != 0) || (EMAC_STATS_PERIOD != 0U)) && (EMAC_CYCLE_DWT != 0))
+  /* Enable DWT cycle counter for interrupt duration, latency and statistics period measurement */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  Emac.flags    = EMAC_FLAG_INIT;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t Uninitialize (void)
+  \brief       De-initialize Ethernet MAC Device.
+  \return      \ref execution_status
+*/
+static int32_t Uninitialize (void) {
+
+#if (EMAC_EVENT_THREAD != 0)
+  if (Emac.ev_thread != NULL) {
+    (void)osThreadTerminate ((osThreadId_t)Emac.ev_thread);
+    Emac.ev_thread = NULL;
+  }
+#endif
+  Emac.flags = 0U;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t PowerControl (ARM_POWER_STATE state)
+  \brief       Control Ethernet MAC Device Power.
+  \param[in]   state  Power state
+  \return      \ref execution_status
+*/
+static int32_t PowerControl (ARM_POWER_STATE state) {
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  uint32_t primask;
+#endif
+
+  switch (state) {
+    case ARM_POWER_OFF:
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+      primask = __get_PRIMASK ();
+      __disable_irq ();
+      MdioAbort ();
+      __set_PRIMASK (primask);
+#endif
+#if (EMAC_LINK_MONITOR != 0)
+      (void)Driver_GPIO0.SetEventTrigger (EMAC_PHY_INT_PIN, ARM_GPIO_TRIGGER_NONE);
+      Emac.link_state = ARM_ETH_LINK_DOWN;
+#endif
+      ENET_Deinit (ENET);
+
+      /* Disable ENET interrupts in NVIC */
+      NVIC_DisableIRQ (ENET_IRQn);
+#if (EMAC_TIMESTAMP != 0)
+      NVIC_DisableIRQ (ENET_1588_Timer_IRQn);
+#endif
+
+      Emac.flags = EMAC_FLAG_INIT;
+      break;
+
+    case ARM_POWER_LOW:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+
+    case ARM_POWER_FULL:
+      if (Emac.flags & EMAC_FLAG_POWER) {
+        /* Driver already powered */
+        break;
+      }
+
+      /* Setup MAC configuration */
+      #if (EMAC_TX_FIFO_WATERMARK != 0U)
+      Emac.cfg.macSpecialConfig = kENET_ControlStoreAndFwdDisable;
+      #else
+      Emac.cfg.macSpecialConfig = 0U;
+      #endif
+
+      Emac.cfg.interrupt     = kENET_TxFrameInterrupt | kENET_RxFrameInterrupt | kENET_WakeupInterrupt;
+      Emac.cfg.rxMaxFrameLen = EMAC_BUF_SIZE;
+
+      #if (EMAC_MII_MODE == ARM_ETH_INTERFACE_MII)
+      Emac.cfg.miiMode   = kENET_MiiMode;
+      #else
+      Emac.cfg.miiMode   = kENET_RmiiMode;
+      #endif
+      Emac.cfg.miiSpeed  = kENET_MiiSpeed100M;
+      Emac.cfg.miiDuplex = kENET_MiiFullDuplex;
+
+      #if (EMAC_RX_SHIFT16 != 0)
+      Emac.cfg.rxAccelerConfig      = kENET_RxAccelisShift16Enabled;
+      #else
+      Emac.cfg.rxAccelerConfig      = 0U;
+      #endif
+      Emac.cfg.txAccelerConfig      = 0U;
+      Emac.cfg.pauseDuration        = 0U;
+      Emac.cfg.rxFifoEmptyThreshold = 0U;
+      Emac.cfg.rxFifoFullThreshold  = 0U;
+      Emac.cfg.txFifoWatermark      = (uint8_t)EMAC_TX_FIFO_WATERMARK;
+      Emac.cfg.ringNum              = 1U;
+      Emac.cfg.callback             = ENET_IRQCallback;
+
+      /* Initialize and apply configuration */
+      EnetInit ();
+
+      /* Enable ENET peripheral interrupts in NVIC */
+      NVIC_EnableIRQ (ENET_IRQn);
+
+      Emac.flags |= EMAC_FLAG_POWER;
+      break;
+
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t GetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr)
+  \brief       Get Ethernet MAC Address.
+  \param[in]   ptr_addr  Pointer to address
+  \return      \ref execution_status
+*/
+static int32_t GetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr) {
+
+  if (ptr_addr == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  ENET_GetMacAddr (ENET, (uint8_t *)ptr_addr);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr)
+  \brief       Set Ethernet MAC Address.
+  \param[in]   ptr_addr  Pointer to address
+  \return      \ref execution_status
+*/
+static int32_t SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
+
+  if (ptr_addr == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  memcpy (Emac.addr, ptr_addr, 6);
+
+  ENET_SetMacAddr (ENET, (uint8_t *)ptr_addr);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr,
+                                               uint32_t          num_addr)
+  \brief       Configure Address Filter.
+  \param[in]   ptr_addr  Pointer to addresses
+  \param[in]   num_addr  Number of addresses to configure
+  \return      \ref execution_status
+*/
+static int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
+  uint32_t cnt;
+
+  if ((ptr_addr == NULL) && (num_addr != 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  ENET->GALR = 0U;
+  ENET->GAUR = 0U;
+
+#if (EMAC_MCAST_CNT > 0U)
+  /* Disable exact filter while the address table is updated */
+  Emac.mc_flt = 0U;
+  Emac.mc_cnt = 0U;
+  Emac.mc_fp  = 0U;
+#endif
+
+  if (num_addr != 0U) {
+    for (cnt = 0U; cnt < num_addr; cnt++) {
+      /* Add multicast group to hash table */
+      ENET_AddMulticastGroup (ENET, (uint8_t *)&ptr_addr[cnt]);
+    }
+
+#if (EMAC_MCAST_CNT > 0U)
+    if (num_addr <= EMAC_MCAST_CNT) {
+      /* Copy addresses to exact multicast address table */
+      memcpy (Mc_Addr, ptr_addr, num_addr * sizeof(ARM_ETH_MAC_ADDR));
+      memset (Mc_Hit, 0, sizeof(Mc_Hit));
+      Emac.mc_cnt = (uint8_t)num_addr;
+      if ((Emac.cfg.macSpecialConfig & kENET_ControlPromiscuousEnable) == 0U) {
+        Emac.mc_flt = 1U;
+      }
+    }
+#endif
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+#if ((EMAC_CAPTURE_SIZE > 0U) && (EMAC_TX_ZERO_COPY != 0))
+/**
+  \fn          void CaptureTxDesc (void)
+  \brief       Capture frame assembled from transmit fragment descriptors.
+*/
+static void CaptureTxDesc (void) {
+  volatile enet_tx_bd_struct_t *bd;
+  uint32_t i, len;
+
+  len = 0U;
+  for (i = 0U; i < Emac.tx_frag; i++) {
+    len += Tx_Desc[(Emac.tx_first + i) % EMAC_TX_BUF_CNT].length;
+  }
+
+  if (CaptureBegin (EMAC_CAP_TX, len) != 0U) {
+    for (i = 0U; i < Emac.tx_frag; i++) {
+      bd = &Tx_Desc[(Emac.tx_first + i) % EMAC_TX_BUF_CNT];
+      CaptureData (EMAC_CAP_TX, (const uint8_t *)bd->buffer, bd->length);
+    }
+    CaptureEnd (EMAC_CAP_TX);
+  }
+}
+#endif
+
+/**
+  \fn          int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags)
+  \brief       Send Ethernet frame.
+  \param[in]   frame  Pointer to frame buffer with data to send
+  \param[in]   len    Frame buffer length in bytes
+  \param[in]   flags  Frame transmit flags (see ARM_ETH_MAC_TX_FRAME_...)
+  \return      \ref execution_status
+*/
+static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
+#if (EMAC_TX_ZERO_COPY != 0)
+  volatile enet_tx_bd_struct_t *bd;
+  uint16_t ctrl;
+#else
+  uint32_t primask;
+  uint32_t event = 0U;
+#endif
+#if (EMAC_LATENCY != 0)
+  uint32_t time = EMAC_CYCLE_COUNT ();
+#endif
+
+  if ((frame == NULL) || (len == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+#if (EMAC_TIMESTAMP != 0)
+  if (((flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) != 0U) && (Emac.tx_ts != 0U) &&
+      ((Emac.tx_frag == 0U) || (Emac.tx_frag_ts == 0U))) {
+    /* Timestamp of an earlier frame not yet read with GetTxFrameTime */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+#endif
+
+#if (EMAC_TX_ZERO_COPY != 0)
+  if ((len > EMAC_BUF_SIZE) || (Emac.tx_frag == EMAC_TX_BUF_CNT)) {
+    /* Fragment size invalid or too many fragments, discard frame */
+    if (Emac.tx_frag != 0U) {
+      Emac.tx_idx = Emac.tx_first;
+    }
+    while (Emac.tx_frag != 0U) {
+      Emac.tx_frag--;
+      Tx_Desc[(Emac.tx_first + Emac.tx_frag) % EMAC_TX_BUF_CNT].control &= ~ENET_BUFFDESCRIPTOR_TX_READY_MASK;
+    }
+#if (EMAC_TIMESTAMP != 0)
+    if (Emac.tx_ts_idx >= EMAC_TX_BUF_CNT) {
+      Emac.tx_ts = 0U;
+    }
+#endif
+    return ARM_DRIVER_ERROR;
+  }
+
+  bd = &Tx_Desc[Emac.tx_idx];
+  if (((bd->control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0U) ||
+      ((Emac.tx_frag != 0U) && (Emac.tx_idx == Emac.tx_first))) {
+    /* No free descriptor */
+    Stats.tx_busy++;
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  SCB_CleanDCache_by_Addr ((void *)(uint32_t)frame, (int32_t)len);
+#endif
+
+  /* Map fragment onto descriptor, first descriptor is handed over last */
+  ctrl = bd->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK;
+  if (Emac.tx_frag == 0U) {
+    Emac.tx_first = Emac.tx_idx;
+#if (EMAC_TIMESTAMP != 0)
+    Emac.tx_frag_ts = 0U;
+#endif
+#if (EMAC_LATENCY != 0)
+    Emac.lat_tx_t0 = time;
+#endif
+  } else {
+    ctrl |= ENET_BUFFDESCRIPTOR_TX_READY_MASK;
+  }
+  if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) == 0U) {
+    ctrl |= ENET_BUFFDESCRIPTOR_TX_LAST_MASK | ENET_BUFFDESCRIPTOR_TX_TRANMITCRC_MASK;
+#if (EMAC_LATENCY != 0)
+    /* Frame completes with the last descriptor */
+    Tx_Stamp[Emac.tx_idx]   = Emac.lat_tx_t0;
+    Tx_StampOk[Emac.tx_idx] = 1U;
+#endif
+  }
+  bd->buffer = (uint32_t)frame;
+  bd->length = (uint16_t)len;
+#if (EMAC_TIMESTAMP != 0)
+  if ((flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) != 0U) {
+    Emac.tx_frag_ts = 1U;
+  }
+  bd->controlExtend1 = ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK;
+  if (Emac.tx_frag_ts != 0U) {
+    /* Capture transmit timestamp */
+    bd->controlExtend1 |= ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
+    Emac.tx_ts = 1U;
+    if ((ctrl & ENET_BUFFDESCRIPTOR_TX_LAST_MASK) != 0U) {
+      /* Timestamp is written back to the last descriptor, first descriptor is not yet handed over */
+      Tx_Desc[Emac.tx_first].controlExtend1 |= ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
+      Emac.tx_ts_idx = Emac.tx_idx;
+    } else {
+      Emac.tx_ts_idx = EMAC_TX_BUF_CNT;
+    }
+  }
+#endif
+  __DMB ();
+  bd->control = ctrl;
+
+  Emac.tx_frag++;
+  if (++Emac.tx_idx == EMAC_TX_BUF_CNT) {
+    Emac.tx_idx = 0U;
+  }
+
+  if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) == 0U) {
+    /* Last fragment, send frame */
+#if (EMAC_CAPTURE_SIZE > 0U)
+    if (Emac.cap_on != 0U) {
+      CaptureTxDesc ();
+    }
+#endif
+    __DMB ();
+    Tx_Desc[Emac.tx_first].control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK;
+    Emac.tx_frag = 0U;
+    ENET->TDAR = ENET_TDAR_TDAR_MASK;
+#if (EMAC_LATENCY != 0)
+    LatencyAdd (EMAC_LATENCY_TX_SEND, EMAC_CYCLE_COUNT () - Emac.lat_tx_t0);
+#endif
+  }
+#else
+  if (Emac.tx_len == 0U) {
+#if (EMAC_LATENCY != 0)
+    Emac.lat_tx_t0 = time;
+#endif
+    if ((Emac.tx_qcnt + Emac.tx_dcnt) == EMAC_TX_SLOT_CNT) {
+      primask = __get_PRIMASK ();
+      __disable_irq ();
+      TxReclaim ();
+      __set_PRIMASK (primask);
+    }
+    if ((Emac.tx_qcnt + Emac.tx_dcnt) == EMAC_TX_SLOT_CNT) {
+      /* Transmit queue is full */
+      Stats.tx_busy++;
+      return ARM_DRIVER_ERROR_BUSY;
+    }
+  }
+
+  if ((Emac.tx_len + len) > EMAC_BUF_SIZE) {
+    /* Frame size invalid, discard frame */
+    Emac.tx_len = 0U;
+    return ARM_DRIVER_ERROR;
+  }
+
+  /* Copy fragment directly into frame slot buffer */
+  if (((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) != 0U) || (Emac.tx_len != 0U)) {
+    Stats.tx_frag_copy++;
+  }
+  memcpy (&Tx_Buf[Emac.tx_put][Emac.tx_len], frame, len);
+  Emac.tx_len += len;
+
+  if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) == 0U) {
+    /* Last fragment, send frame */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr (&Tx_Buf[Emac.tx_put][0], (int32_t)Emac.tx_len);
+#endif
+#if (EMAC_CAPTURE_SIZE > 0U)
+    if (Emac.cap_on != 0U) {
+      CaptureFrame (EMAC_CAP_TX, &Tx_Buf[Emac.tx_put][0], Emac.tx_len);
+    }
+#endif
+    Tx_Len[Emac.tx_put] = (uint16_t)Emac.tx_len;
+#if (EMAC_TIMESTAMP != 0)
+    if ((flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) != 0U) {
+      Tx_Len[Emac.tx_put] |= EMAC_TX_LEN_TS;
+    }
+#endif
+#if (EMAC_LATENCY != 0)
+    Tx_SlotStamp[Emac.tx_put] = Emac.lat_tx_t0;
+#endif
+    Emac.tx_len = 0U;
+    if (++Emac.tx_put == EMAC_TX_SLOT_CNT) {
+      Emac.tx_put = 0U;
+    }
+
+    primask = __get_PRIMASK ();
+    __disable_irq ();
+#if (EMAC_TIMESTAMP != 0)
+    if ((flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) != 0U) {
+      /* Timestamped frame queued, descriptor is assigned by TxSubmit */
+      Emac.tx_ts     = 1U;
+      Emac.tx_ts_idx = EMAC_TX_BUF_CNT;
+    }
+#endif
+    Emac.tx_qcnt++;
+    TxReclaim ();
+    TxSubmit ();
+#if (EMAC_TX_QUEUE_LEN != 0U)
+    if ((Emac.tx_wm == 0U) && ((Emac.tx_qcnt + Emac.tx_dcnt) >= EMAC_TX_QUEUE_HIGH)) {
+      /* High watermark reached */
+      Emac.tx_wm = 1U;
+      event = EMAC_EVENT_TX_QUEUE_HIGH;
+    }
+#endif
+    __set_PRIMASK (primask);
+
+#if (EMAC_LATENCY != 0)
+    LatencyAdd (EMAC_LATENCY_TX_SEND, EMAC_CYCLE_COUNT () - Emac.lat_tx_t0);
+#endif
+    SignalEvent (event);
+  }
+#endif
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t ReadFrame (uint8_t *frame, uint32_t len)
+  \brief       Read data of received Ethernet frame.
+  \param[in]   frame  Pointer to frame buffer for data to read into
+  \param[in]   len    Frame buffer length in bytes
+  \return      number of data bytes read or execution status
+                 - value >= 0: number of data bytes read
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status 
+*/
+static int32_t ReadFrame (uint8_t *frame, uint32_t len) {
+  volatile enet_rx_bd_struct_t *bd;
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+  if ((frame == NULL) && (len != 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  bd = RxDescFrame ();
+  if (bd == NULL) {
+    /* No frame available */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (len > (bd->length - EMAC_RX_OFS)) {
+    len = bd->length - EMAC_RX_OFS;
+  }
+  if (len != 0U) {
+    memcpy (frame, (const uint8_t *)bd->buffer + EMAC_RX_OFS, len);
+  }
+  RxFrameRelease (bd);
+
+  return ((int32_t)len);
+}
+
+/**
+  \fn          uint32_t GetRxFrameSize (void)
+  \brief       Get size of received Ethernet frame.
+  \return      number of bytes in received frame
+*/
+static uint32_t GetRxFrameSize (void) {
+  volatile enet_rx_bd_struct_t *bd;
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return (0U);
+  }
+
+  bd = RxDescFrame ();
+  if (bd == NULL) {
+    return (0U);
+  }
+
+  return (bd->length - EMAC_RX_OFS);
+}
+
+/**
+  \fn          int32_t EMAC_ReadFrames (EMAC_FRAME *frames, uint32_t num)
+  \brief       Read data of multiple received Ethernet frames.
+  \param[in,out] frames  Array of frame buffers (len: buffer size on input, number of data bytes read on output)
+  \param[in]   num     Number of frame buffers in array
+  \return      number of frames read or execution status
+                 - value >= 0: number of frames read
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status
+*/
+int32_t EMAC_ReadFrames (EMAC_FRAME *frames, uint32_t num) {
+  volatile enet_rx_bd_struct_t *bd;
+  uint32_t cnt, len;
+
+  if ((frames == NULL) && (num != 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  for (cnt = 0U; cnt < num; cnt++) {
+    bd = RxDescFrame ();
+    if (bd == NULL) {
+      /* No more frames available */
+      break;
+    }
+
+    len = bd->length - EMAC_RX_OFS;
+    if (len > frames[cnt].len) {
+      len = frames[cnt].len;
+    }
+    if (len != 0U) {
+      memcpy (frames[cnt].data, (const uint8_t *)bd->buffer + EMAC_RX_OFS, len);
+    }
+    frames[cnt].len = len;
+
+    RxFrameRelease (bd);
+  }
+
+  return ((int32_t)cnt);
+}
+
+/**
+  \fn          int32_t EMAC_SetRxRule (uint32_t idx, const EMAC_RX_RULE *rule)
+  \brief       Set or clear receive classification rule.
+  \param[in]   idx   Rule index (0 .. EMAC_RX_RULE_CNT-1), lower index is matched first
+  \param[in]   rule  Pointer to rule or NULL to clear the rule
+  \return      \ref execution_status
+*/
+int32_t EMAC_SetRxRule (uint32_t idx, const EMAC_RX_RULE *rule) {
+#if (EMAC_RX_CLASS_CNT > 0U)
+  uint32_t primask;
+
+  if (idx >= EMAC_RX_RULE_CNT) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((rule != NULL) && ((rule->cls >= EMAC_RX_CLASS_CNT) || (rule->pcp > 7U))) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  if (rule == NULL) {
+    Rx_Rule[idx].match = 0U;
+  } else {
+    Rx_Rule[idx] = *rule;
+  }
+  __set_PRIMASK (primask);
+
+  return ARM_DRIVER_OK;
+#else
+  (void)idx;
+  (void)rule;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+
+/**
+  \fn          int32_t EMAC_ReadClassFrame (uint32_t cls, uint8_t *frame, uint32_t len)
+  \brief       Read data of the next received Ethernet frame in given receive class.
+  \param[in]   cls    Receive class (0 .. EMAC_RX_CLASS_CNT-1)
+  \param[in]   frame  Pointer to frame buffer for data to read into
+  \param[in]   len    Frame buffer length in bytes
+  \return      number of data bytes read or execution status
+                 - value > 0: number of data bytes read
+                 - value = 0: no frame available in class
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status
+*/
+int32_t EMAC_ReadClassFrame (uint32_t cls, uint8_t *frame, uint32_t len) {
+#if (EMAC_RX_CLASS_CNT > 0U)
+  volatile enet_rx_bd_struct_t *bd;
+
+  if ((cls >= EMAC_RX_CLASS_CNT) || ((frame == NULL) && (len != 0U))) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  bd = RxClassFrame (cls);
+  if (bd == NULL) {
+    /* No frame available */
+    return (0);
+  }
+
+  if (len > (bd->length - EMAC_RX_OFS)) {
+    len = bd->length - EMAC_RX_OFS;
+  }
+  if (len != 0U) {
+    memcpy (frame, (const uint8_t *)bd->buffer + EMAC_RX_OFS, len);
+  }
+  RxFrameRelease (bd);
+
+  return ((int32_t)len);
+#else
+  (void)cls;
+  (void)frame;
+  (void)len;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+
+/**
+  \fn          int32_t EMAC_PollRx (EMAC_FRAME *frames, uint32_t budget)
+  \brief       Read received Ethernet frames in poll mode, re-enable receive interrupt when drained.
+  \param[in,out] frames  Array of frame buffers (len: buffer size on input, number of data bytes read on output)
+  \param[in]   budget  Maximum number of frames to read
+  \return      number of frames read or execution status
+                 - value < budget: receive ring drained, receive interrupt enabled
+                 - value = budget: more frames may be available, call again
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status
+*/
+int32_t EMAC_PollRx (EMAC_FRAME *frames, uint32_t budget) {
+  uint32_t primask;
+  uint32_t pending;
+  int32_t  cnt, n;
+
+  cnt = EMAC_ReadFrames (frames, budget);
+#if (EMAC_STATS_PERIOD != 0U)
+  if (cnt >= 0) {
+    StatsPoll ();
+  }
+#endif
+
+  while ((cnt >= 0) && ((uint32_t)cnt < budget) && (Emac.rx_polling != 0U)) {
+    primask = __get_PRIMASK ();
+    __disable_irq ();
+
+    /* Clear pending event first, frames received afterwards raise the interrupt again */
+    ENET_ClearInterruptStatus (ENET, kENET_RxFrameInterrupt);
+    pending = RxFramePending ();
+    if (pending == 0U) {
+      /* Receive ring drained, leave poll mode */
+      Emac.rx_polling = 0U;
+      EnetIrqEnable (kENET_RxFrameInterrupt);
+    }
+
+    __set_PRIMASK (primask);
+
+    if (pending == 0U) {
+      break;
+    }
+
+    /* Frames received meanwhile, interrupt remains masked: read into remaining buffers */
+    n = EMAC_ReadFrames (&frames[cnt], budget - (uint32_t)cnt);
+    if (n < 0) {
+      break;
+    }
+    cnt += n;
+  }
+
+  return (cnt);
+}
+
+/**
+  \fn          int32_t EMAC_LoanRxFrame (uint8_t **frame)
+  \brief       Get received Ethernet frame without copying (zero-copy receive).
+  \param[out]  frame  Pointer where the pointer to the frame data is written to
+  \return      number of data bytes in frame or execution status
+                 - value > 0: number of data bytes in frame
+                 - value = 0: no frame available
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status
+*/
+int32_t EMAC_LoanRxFrame (uint8_t **frame) {
+#if (EMAC_RX_LOAN_CNT > 0U)
+  volatile enet_rx_bd_struct_t *bd;
+  uint32_t primask;
+  uint32_t idx, desc;
+  int32_t  len;
+
+  if (frame == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  bd = RxDescFrame ();
+  if (bd == NULL) {
+    /* No frame available */
+    return (0);
+  }
+
+#if (EMAC_RX_SLAB_CNT > 0U)
+  if ((bd >= Rx_SlabDesc) && (bd < &Rx_SlabDesc[EMAC_RX_SLAB_CNT])) {
+    /* Frame copied into slab at receive time, the slab is loaned */
+    *frame = (uint8_t *)bd->buffer + EMAC_RX_OFS;
+    len    = (int32_t)(bd->length - EMAC_RX_OFS);
+#if (EMAC_LATENCY != 0)
+    LatencyRxRead (bd);
+#endif
+#if (EMAC_CAPTURE_SIZE > 0U)
+    if (Emac.cap_on != 0U) {
+      CaptureFrame (EMAC_CAP_RX, *frame, (uint32_t)len);
+    }
+#endif
+    RxSlabDequeue (1U);
+
+    return (len);
+  }
+#endif
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  if (Rx_SpareCnt == 0U) {
+    /* All spare buffers are on loan */
+#if (EMAC_RX_SLAB_CNT > 0U)
+    Emac.rx_own = 0U;
+#endif
+    __set_PRIMASK (primask);
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+  desc = (uint32_t)(bd - Rx_Desc);
+  idx  = Rx_Spare[--Rx_SpareCnt];
+  Rx_Loaned[Rx_Map[desc]] = 1U;
+  __set_PRIMASK (primask);
+
+  *frame = (uint8_t *)bd->buffer + EMAC_RX_OFS;
+  len    = (int32_t)(bd->length - EMAC_RX_OFS);
+#if (EMAC_LATENCY != 0)
+  LatencyRxRead (bd);
+#endif
+#if (EMAC_CAPTURE_SIZE > 0U)
+  if (Emac.cap_on != 0U) {
+    CaptureFrame (EMAC_CAP_RX, *frame, (uint32_t)len);
+  }
+#endif
+
+  /* Re-arm descriptor with spare buffer */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* Discard cache lines of the spare buffer, a later eviction would overwrite received data */
+  SCB_InvalidateDCache_by_Addr (&Rx_Buf[idx][0], (int32_t)EMAC_BUF_SIZE);
+#endif
+  Rx_Map[desc] = (uint16_t)idx;
+  bd->buffer = (uint32_t)&Rx_Buf[idx][0];
+  __DMB ();
+  RxFrameReturn (bd);
 
+  return (len);
+#else
+  (void)frame;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
 
 /**
-  \fn          int32_t Initialize (ARM_ETH_MAC_SignalEvent_t cb_event)
-  \brief       Initialize Ethernet MAC Device.
-  \param[in]   cb_event  Pointer to \ref ARM_ETH_MAC_SignalEvent
+  \fn          int32_t EMAC_ReleaseRxFrame (uint8_t *frame)
+  \brief       Release receive buffer obtained with EMAC_LoanRxFrame.
+  \param[in]   frame  Pointer to frame data returned by EMAC_LoanRxFrame
   \return      \ref execution_status
 */
-static int32_t Initialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
-
-  if (Emac.flags & EMAC_FLAG_INIT) { return ARM_DRIVER_OK; }
+int32_t EMAC_ReleaseRxFrame (uint8_t *frame) {
+#if (EMAC_RX_LOAN_CNT > 0U)
+  uint32_t primask;
+  uint32_t idx;
+
+#if (EMAC_RX_SLAB_CNT > 0U)
+  if ((frame >= &Rx_Slab[0][0]) && (frame < (uint8_t *)&Rx_Slab[EMAC_RX_SLAB_CNT])) {
+    /* Small frame buffer */
+    idx = (uint32_t)(frame - &Rx_Slab[0][0]) / EMAC_RX_SLAB_SIZE;
+
+    primask = __get_PRIMASK ();
+    __disable_irq ();
+    if (Rx_SlabUsed[idx] == 0U) {
+      /* Buffer is not on loan */
+      __set_PRIMASK (primask);
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    Rx_SlabUsed[idx] = 0U;
+    Rx_SlabFree[Rx_SlabCnt++] = (uint16_t)idx;
+    __set_PRIMASK (primask);
 
-  /* Setup Tx/Rx descriptors */
-  Emac.desc_cfg.txBdStartAddrAlign = &Tx_Desc[0];
-  Emac.desc_cfg.txBufferAlign      = &Tx_Buf[0][0];
-  Emac.desc_cfg.txBdNumber         =  EMAC_TX_BUF_CNT;
-  Emac.desc_cfg.txBuffSizeAlign    =  EMAC_BUF_SIZE;
-  Emac.desc_cfg.txMaintainEnable   = true;
+    return ARM_DRIVER_OK;
+  }
+#endif
 
-  Emac.desc_cfg.rxBdStartAddrAlign = &Rx_Desc[0];
-  Emac.desc_cfg.rxBufferAlign      = &Rx_Buf[0][0];
-  Emac.desc_cfg.rxBdNumber         =  EMAC_RX_BUF_CNT;
-  Emac.desc_cfg.rxBuffSizeAlign    =  EMAC_BUF_SIZE;
-  Emac.desc_cfg.rxMaintainEnable   = true;
+  if ((frame < &Rx_Buf[0][0]) || (frame >= (uint8_t *)&Rx_Buf[EMAC_RX_BUF_CNT+EMAC_RX_LOAN_CNT])) {
+    /* Not a receive buffer */
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  idx = (uint32_t)(frame - &Rx_Buf[0][0]) / EMAC_BUF_SIZE;
 
-  /* Get ethernet peripheral clock */
-  Emac.pclk = CLOCK_GetFreq (kCLOCK_IpgClk);
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* Drop lines written by the application while the buffer was on loan */
+  SCB_InvalidateDCache_by_Addr (&Rx_Buf[idx][0], (int32_t)EMAC_BUF_SIZE);
+#endif
 
-  /* Register driver callback function */
-  Emac.cb_event = cb_event;
-  Emac.flags    = EMAC_FLAG_INIT;
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  if (Rx_Loaned[idx] == 0U) {
+    /* Buffer is not on loan */
+    __set_PRIMASK (primask);
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  Rx_Loaned[idx] = 0U;
+  Rx_Spare[Rx_SpareCnt++] = (uint16_t)idx;
+  __set_PRIMASK (primask);
 
   return ARM_DRIVER_OK;
+#else
+  (void)frame;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
-  \fn          int32_t Uninitialize (void)
-  \brief       De-initialize Ethernet MAC Device.
-  \return      \ref execution_status
+  \fn          int32_t EMAC_GetMulticastStats (uint32_t *hit, uint32_t num, uint32_t *false_pos)
+  \brief       Get exact multicast address filter counters.
+  \param[out]  hit        Pointer to array receiving number of frames received for each configured address
+                          (in the order passed to SetAddressFilter), can be NULL
+  \param[in]   num        Number of elements in hit array
+  \param[out]  false_pos  Pointer to number of discarded hash filter false positive frames, can be NULL
+  \return      number of addresses in exact multicast address table or \ref execution_status
 */
-static int32_t Uninitialize (void) {
+int32_t EMAC_GetMulticastStats (uint32_t *hit, uint32_t num, uint32_t *false_pos) {
+#if (EMAC_MCAST_CNT > 0U)
+  uint32_t i;
 
-  Emac.flags = 0U;
+  if ((hit == NULL) && (num != 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
 
-  return ARM_DRIVER_OK;
+  if (num > Emac.mc_cnt) {
+    num = Emac.mc_cnt;
+  }
+  for (i = 0U; i < num; i++) {
+    hit[i] = Mc_Hit[i];
+  }
+  if (false_pos != NULL) {
+    *false_pos = Emac.mc_fp;
+  }
+
+  return ((int32_t)Emac.mc_cnt);
+#else
+  (void)hit;
+  (void)num;
+  (void)false_pos;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
-  \fn          int32_t PowerControl (ARM_POWER_STATE state)
-  \brief       Control Ethernet MAC Device Power.
-  \param[in]   state  Power state
+  \fn          int32_t EMAC_SetUnicastFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr)
+  \brief       Configure additional unicast addresses received besides the station address.
+  \param[in]   ptr_addr  Pointer to addresses
+  \param[in]   num_addr  Number of addresses to configure (0 = station address only)
   \return      \ref execution_status
 */
-static int32_t PowerControl (ARM_POWER_STATE state) {
-
-  switch (state) {
-    case ARM_POWER_OFF:
-      ENET_Deinit (ENET);
-
-      /* Disable ENET interrupts in NVIC */
-      NVIC_DisableIRQ (ENET_IRQn);
-
-      Emac.flags = EMAC_FLAG_INIT;
-      break;
-
-    case ARM_POWER_LOW:
-      return ARM_DRIVER_ERROR_UNSUPPORTED;
-
-    case ARM_POWER_FULL:
-      if (Emac.flags & EMAC_FLAG_POWER) {
-        /* Driver already powered */
-        break;
-      }
-
-      /* Setup MAC configuration */
-      #if (EMAC_CHECKSUM_OFFLOAD == 0U)
-      Emac.cfg.macSpecialConfig = kENET_ControlStoreAndFwdDisable;
-      #else
-      Emac.cfg.macSpecialConfig = 0U;
-      #endif
-
-      Emac.cfg.interrupt     = kENET_TxFrameInterrupt | kENET_RxFrameInterrupt | kENET_WakeupInterrupt;
-      Emac.cfg.rxMaxFrameLen = EMAC_BUF_SIZE;
-
-      #if (EMAC_MII_MODE == ARM_ETH_INTERFACE_MII)
-      Emac.cfg.miiMode   = kENET_MiiMode;
-      #else
-      Emac.cfg.miiMode   = kENET_RmiiMode;
-      #endif
-      Emac.cfg.miiSpeed  = kENET_MiiSpeed100M;
-      Emac.cfg.miiDuplex = kENET_MiiFullDuplex;
+int32_t EMAC_SetUnicastFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
+#if (EMAC_UCAST_CNT > 0U)
+  uint32_t i;
 
-      Emac.cfg.rxAccelerConfig      = 0U;
-      Emac.cfg.txAccelerConfig      = 0U;
-      Emac.cfg.pauseDuration        = 0U;
-      Emac.cfg.rxFifoEmptyThreshold = 0U;
-      Emac.cfg.rxFifoFullThreshold  = 0U;
-      Emac.cfg.txFifoWatermark      = 0U;
-      Emac.cfg.ringNum              = 1U;
-      Emac.cfg.callback             = ENET_IRQCallback;
+  if ((ptr_addr == NULL) && (num_addr != 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (num_addr > EMAC_UCAST_CNT) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  for (i = 0U; i < num_addr; i++) {
+    if ((ptr_addr[i].b[0] & 0x01U) != 0U) {
+      /* Group address */
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+  }
 
-      /* Initialize and apply configuration */
-      ENET_Init (ENET, &Emac.h, &Emac.cfg, &Emac.desc_cfg, Emac.addr, Emac.pclk);
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
 
-      /* Enable ENET peripheral interrupts in NVIC */
-      NVIC_EnableIRQ (ENET_IRQn);
+  /* Disable exact filter while the address table is updated */
+  Emac.uc_flt = 0U;
+  Emac.uc_cnt = 0U;
 
-      Emac.flags |= EMAC_FLAG_POWER;
-      break;
+  if (num_addr != 0U) {
+    memcpy (Uc_Addr, ptr_addr, num_addr * sizeof(ARM_ETH_MAC_ADDR));
+  }
+  Emac.uc_cnt = (uint8_t)num_addr;
+  UcastApply ();
 
-    default:
-      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  if ((num_addr != 0U) && ((Emac.cfg.macSpecialConfig & kENET_ControlPromiscuousEnable) == 0U)) {
+    Emac.uc_flt = 1U;
   }
 
   return ARM_DRIVER_OK;
+#else
+  (void)ptr_addr;
+  (void)num_addr;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
-  \fn          int32_t GetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr)
-  \brief       Get Ethernet MAC Address.
-  \param[in]   ptr_addr  Pointer to address
+  \fn          int32_t EMAC_CaptureStart (uint32_t snaplen, uint32_t sample)
+  \brief       Start capture of received and transmitted frames.
+  \param[in]   snaplen  Maximum number of bytes captured per frame
+  \param[in]   sample   Capture every n-th frame (1 = all frames)
   \return      \ref execution_status
 */
-static int32_t GetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr) {
+int32_t EMAC_CaptureStart (uint32_t snaplen, uint32_t sample) {
+#if (EMAC_CAPTURE_SIZE > 0U)
 
-  if (ptr_addr == NULL) {
+  if ((snaplen == 0U) || (sample == 0U) || (sample > 0xFFFFU)) {
     return ARM_DRIVER_ERROR_PARAMETER;
   }
+  if (snaplen > EMAC_BUF_SIZE) {
+    snaplen = EMAC_BUF_SIZE;
+  }
 
-  ENET_GetMacAddr (ENET, (uint8_t *)ptr_addr);
+  Emac.cap_on     = 0U;
+  Emac.cap_snap   = (uint16_t)snaplen;
+  Emac.cap_sample = (uint16_t)sample;
+  Emac.cap[EMAC_CAP_RX].cnt = (uint16_t)(sample - 1U);
+  Emac.cap[EMAC_CAP_TX].cnt = (uint16_t)(sample - 1U);
+  __DMB ();
+  Emac.cap_on     = 1U;
 
   return ARM_DRIVER_OK;
+#else
+  (void)snaplen;
+  (void)sample;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
-  \fn          int32_t SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr)
-  \brief       Set Ethernet MAC Address.
-  \param[in]   ptr_addr  Pointer to address
+  \fn          int32_t EMAC_CaptureStop (void)
+  \brief       Stop frame capture, captured records remain in the ring buffer.
   \return      \ref execution_status
 */
-static int32_t SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
+int32_t EMAC_CaptureStop (void) {
+#if (EMAC_CAPTURE_SIZE > 0U)
+  Emac.cap_on = 0U;
+  return ARM_DRIVER_OK;
+#else
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
 
-  if (ptr_addr == NULL) {
-    return ARM_DRIVER_ERROR_PARAMETER;
-  }
+/**
+  \fn          uint32_t EMAC_CaptureHeader (uint8_t *buf)
+  \brief       Get pcap file header.
+  \param[out]  buf   Pointer to buffer of at least 24 bytes
+  \return      number of bytes written
+*/
+uint32_t EMAC_CaptureHeader (uint8_t *buf) {
+  uint32_t hdr[6];
 
-  if ((Emac.flags & EMAC_FLAG_POWER) == 0) {
-    /* Driver not yet powered */
-    return ARM_DRIVER_ERROR;
+  if (buf == NULL) {
+    return (0U);
   }
 
-  memcpy (Emac.addr, ptr_addr, 6);
-
-  ENET_SetMacAddr (ENET, (uint8_t *)ptr_addr);
+  hdr[0] = 0xA1B2C3D4U;                 /* Magic number (microsecond timestamps)  */
+  hdr[1] = 2U | (4UL << 16);            /* Version 2.4                            */
+  hdr[2] = 0U;                          /* Time zone offset                       */
+  hdr[3] = 0U;                          /* Timestamp accuracy                     */
+  hdr[4] = EMAC_BUF_SIZE;               /* Snap length                            */
+  hdr[5] = 1U;                          /* Link type: Ethernet                    */
+  memcpy (buf, hdr, sizeof(hdr));
 
-  return ARM_DRIVER_OK;
+  return (sizeof(hdr));
 }
 
 /**
-  \fn          int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr,
-                                               uint32_t          num_addr)
-  \brief       Configure Address Filter.
-  \param[in]   ptr_addr  Pointer to addresses
-  \param[in]   num_addr  Number of addresses to configure
-  \return      \ref execution_status
+  \fn          int32_t EMAC_CaptureRead (uint8_t *buf, uint32_t len)
+  \brief       Read captured pcap records from the capture ring buffer.
+  \param[out]  buf   Pointer to buffer for pcap records
+  \param[in]   len   Buffer size in bytes
+  \return      number of bytes read or execution status
+                 - value >= 0: number of bytes read (complete records only)
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status
 */
-static int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
-  uint32_t cnt;
+int32_t EMAC_CaptureRead (uint8_t *buf, uint32_t len) {
+#if (EMAC_CAPTURE_SIZE > 0U)
+  uint32_t hdr[2][4];
+  uint32_t head[2], tail[2];
+  uint32_t cnt, rec, dir;
 
-  if ((ptr_addr == NULL) && (num_addr != 0U)) {
+  if ((buf == NULL) && (len != 0U)) {
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
-    /* Driver not yet powered */
-    return ARM_DRIVER_ERROR;
+  for (dir = 0U; dir < 2U; dir++) {
+    head[dir] = Emac.cap[dir].head;
+    tail[dir] = Emac.cap[dir].tail;
   }
+  __DMB ();
 
-  ENET->GALR = 0U;
-  ENET->GAUR = 0U;
+  cnt = 0U;
+  while ((tail[EMAC_CAP_RX] != head[EMAC_CAP_RX]) || (tail[EMAC_CAP_TX] != head[EMAC_CAP_TX])) {
+    for (dir = 0U; dir < 2U; dir++) {
+      if (tail[dir] != head[dir]) {
+        CaptureFetch (dir, tail[dir], (uint8_t *)hdr[dir], sizeof(hdr[0]));
+      }
+    }
+    /* Select the older record */
+    if (tail[EMAC_CAP_RX] == head[EMAC_CAP_RX]) {
+      dir = EMAC_CAP_TX;
+    } else if (tail[EMAC_CAP_TX] == head[EMAC_CAP_TX]) {
+      dir = EMAC_CAP_RX;
+    } else if ((hdr[EMAC_CAP_TX][0] <  hdr[EMAC_CAP_RX][0]) ||
+              ((hdr[EMAC_CAP_TX][0] == hdr[EMAC_CAP_RX][0]) && (hdr[EMAC_CAP_TX][1] < hdr[EMAC_CAP_RX][1]))) {
+      dir = EMAC_CAP_TX;
+    } else {
+      dir = EMAC_CAP_RX;
+    }
 
-  if (num_addr != 0U) {
-    for (cnt = 0U; cnt < num_addr; cnt++) {
-      /* Add multicast group to hash table */
-      ENET_AddMulticastGroup (ENET, (uint8_t *)&ptr_addr[cnt]);
+    rec = sizeof(hdr[0]) + hdr[dir][2];
+    if ((len - cnt) < rec) {
+      /* Record does not fit into buffer */
+      break;
     }
+    CaptureFetch (dir, tail[dir], &buf[cnt], rec);
+    cnt       += rec;
+    tail[dir] += sizeof(hdr[0]) + ((hdr[dir][2] + 3U) & ~3U);
   }
 
-  return ARM_DRIVER_OK;
+  __DMB ();
+  Emac.cap[EMAC_CAP_RX].tail = tail[EMAC_CAP_RX];
+  Emac.cap[EMAC_CAP_TX].tail = tail[EMAC_CAP_TX];
+
+  if ((cnt == 0U) && ((tail[EMAC_CAP_RX] != head[EMAC_CAP_RX]) || (tail[EMAC_CAP_TX] != head[EMAC_CAP_TX]))) {
+    /* Buffer too small for a single record */
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  return ((int32_t)cnt);
+#else
+  (void)buf;
+  (void)len;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
-  \fn          int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags)
-  \brief       Send Ethernet frame.
-  \param[in]   frame  Pointer to frame buffer with data to send
-  \param[in]   len    Frame buffer length in bytes
-  \param[in]   flags  Frame transmit flags (see ARM_ETH_MAC_TX_FRAME_...)
+  \fn          void EMAC_CaptureTime (uint32_t *sec, uint32_t *usec)
+  \brief       Get timestamp of captured frame (weak, can be overridden by the application).
+  \param[out]  sec   Pointer to seconds
+  \param[out]  usec  Pointer to microseconds
+*/
+__WEAK void EMAC_CaptureTime (uint32_t *sec, uint32_t *usec) {
+#if (EMAC_TIMESTAMP != 0)
+  enet_ptp_time_t t;
+
+  ENET_Ptp1588GetTimer (ENET, &Emac.h, &t);
+  *sec  = (uint32_t)t.second;
+  *usec = t.nanosecond / 1000U;
+#else
+  *sec  = 0U;
+  *usec = 0U;
+#endif
+}
+
+/**
+  \fn          int32_t EMAC_GetLatency (uint32_t type, uint32_t *hist, uint32_t num, uint32_t reset)
+  \brief       Get latency histogram (requires EMAC_LATENCY).
+  \param[in]   type   Histogram (EMAC_LATENCY_RX_READ, EMAC_LATENCY_TX_SEND or EMAC_LATENCY_TX_DONE)
+  \param[out]  hist   Pointer to array of bin counters (NULL = only reset)
+  \param[in]   num    Number of elements in array
+  \param[in]   reset  Clear histogram after reading (0 = no, 1 = yes)
+  \return      number of bins read or execution status when negative
+*/
+int32_t EMAC_GetLatency (uint32_t type, uint32_t *hist, uint32_t num, uint32_t reset) {
+#if (EMAC_LATENCY != 0)
+  uint32_t primask, i;
+
+  if (type > EMAC_LATENCY_TX_DONE) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((hist == NULL) || (num > EMAC_LATENCY_BINS)) {
+    num = (hist == NULL) ? 0U : EMAC_LATENCY_BINS;
+  }
+
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  for (i = 0U; i < num; i++) {
+    hist[i] = Lat_Hist[type][i];
+  }
+  if (reset != 0U) {
+    memset (Lat_Hist[type], 0, sizeof(Lat_Hist[type]));
+  }
+  __set_PRIMASK (primask);
+
+  return ((int32_t)num);
+#else
+  (void)type;
+  (void)hist;
+  (void)num;
+  (void)reset;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+
+/**
+  \fn          int32_t EMAC_MDIO_Submit (EMAC_MDIO_XFER *xfer)
+  \brief       Queue MDIO transaction.
+  \param[in]   xfer  Pointer to MDIO transaction (phy_addr, reg_addr, write, data and cb_done set by caller)
   \return      \ref execution_status
 */
-static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
-  status_t stat = 0;
+int32_t EMAC_MDIO_Submit (EMAC_MDIO_XFER *xfer) {
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  uint32_t primask;
+  uint32_t idx;
 
-  if ((frame == NULL) || (len == 0U)) {
+  if ((xfer == NULL) || (xfer->phy_addr > 31U) || (xfer->reg_addr > 31U)) {
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
   if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
-    /* Driver not yet powered */
+    /* Driver not powered */
     return ARM_DRIVER_ERROR;
   }
 
-  if ((Tx_IntLen + len) > sizeof(Tx_IntBuf)) {
-    /* Frame size invalid */
-    return ARM_DRIVER_ERROR;
-  }
+  primask = __get_PRIMASK ();
+  __disable_irq ();
 
-  if ((Tx_IntLen == 0U) && ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) == 0)) {
-    /* Frame not fragmented */
-    stat = ENET_SendFrame (ENET, &Emac.h, frame, len, 0U, 0U, NULL);
-  }
-  else {
-    memcpy (&Tx_IntBuf[Tx_IntLen], frame, len);
-    Tx_IntLen += len;
-    if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) == 0) {
-      /* Last fragment, send frame */
-      stat = ENET_SendFrame (ENET, &Emac.h, Tx_IntBuf, Tx_IntLen, 0U, 0U, NULL);
-      Tx_IntLen = 0U;
+#if (EMAC_PHY_CACHE_REGS != 0U)
+  if ((xfer->write == 0U) && (PhyCacheRead (xfer->phy_addr, xfer->reg_addr, &xfer->data) != 0U)) {
+    /* Cached register, complete immediately */
+    __set_PRIMASK (primask);
+    xfer->status = EMAC_MDIO_DONE;
+    if (xfer->cb_done != NULL) {
+      xfer->cb_done (xfer);
     }
+    return ARM_DRIVER_OK;
   }
-  if (stat == kStatus_ENET_TxFrameBusy) {
+#endif
+
+  if (Emac.mdio_cnt == EMAC_MDIO_QUEUE_LEN) {
+    /* Queue full */
+    __set_PRIMASK (primask);
     return ARM_DRIVER_ERROR_BUSY;
   }
 
+  xfer->status = EMAC_MDIO_PENDING;
+
+  idx = Emac.mdio_get + Emac.mdio_cnt;
+  if (idx >= EMAC_MDIO_QUEUE_LEN) {
+    idx -= EMAC_MDIO_QUEUE_LEN;
+  }
+  Mdio_Queue[idx] = xfer;
+  Emac.mdio_cnt++;
+
+  if (Emac.mdio_cnt == 1U) {
+    /* MDIO idle, start transaction */
+    MdioStart ();
+  }
+  __set_PRIMASK (primask);
+
   return ARM_DRIVER_OK;
+#else
+  (void)xfer;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
-  \fn          int32_t ReadFrame (uint8_t *frame, uint32_t len)
-  \brief       Read data of received Ethernet frame.
-  \param[in]   frame  Pointer to frame buffer for data to read into
-  \param[in]   len    Frame buffer length in bytes
-  \return      number of data bytes read or execution status
-                 - value >= 0: number of data bytes read
-                 - value < 0: error occurred, value is execution status as defined with \ref execution_status 
+  \fn          int32_t EMAC_GetStatistics (EMAC_STATS *stats)
+  \brief       Get ENET MIB and driver statistics.
+  \param[out]  stats  Pointer to statistics structure
+  \return      \ref execution_status
 */
-static int32_t ReadFrame (uint8_t *frame, uint32_t len) {
-  status_t stat;
-  int32_t rval;
+int32_t EMAC_GetStatistics (EMAC_STATS *stats) {
+  uint32_t primask;
+
+  if (stats == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
 
   if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
-    /* Driver not yet powered */
+    /* Driver not powered */
     return ARM_DRIVER_ERROR;
   }
-  if ((frame == NULL) && (len != 0U)) {
-    return ARM_DRIVER_ERROR_PARAMETER;
-  }
 
-  stat = ENET_ReadFrame (ENET, &Emac.h, frame, len, 0U, NULL);
+  StatsUpdate (0U);
 
-  if (stat == kStatus_Success) {
-    rval = (int32_t)len;
-  } else {
-    rval = ARM_DRIVER_ERROR;
-  }
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  memcpy (stats, &Stats, sizeof(EMAC_STATS));
+  __set_PRIMASK (primask);
 
-  return (rval);
+  return ARM_DRIVER_OK;
 }
 
 /**
-  \fn          uint32_t GetRxFrameSize (void)
-  \brief       Get size of received Ethernet frame.
-  \return      number of bytes in received frame
+  \fn          int32_t EMAC_GetStatisticsDelta (EMAC_STATS *snapshot, EMAC_STATS *delta)
+  \brief       Get statistics increments since previous snapshot and update snapshot.
+  \param[in,out] snapshot  Pointer to snapshot structure (zero initialized before first call)
+  \param[out]  delta     Pointer to structure receiving counter increments
+  \return      \ref execution_status
 */
-static uint32_t GetRxFrameSize (void) {
-  status_t stat;
-  uint32_t len;
+int32_t EMAC_GetStatisticsDelta (EMAC_STATS *snapshot, EMAC_STATS *delta) {
+  EMAC_STATS cur;
+  uint32_t  *c, *s, *d;
+  uint32_t   i;
+  int32_t    rval;
 
-  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
-    /* Driver not yet powered */
-    return (0U);
+  if ((snapshot == NULL) || (delta == NULL)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  do {
-    stat = ENET_GetRxFrameSize (&Emac.h, &len, 0U);
+  rval = EMAC_GetStatistics (&cur);
+  if (rval != ARM_DRIVER_OK) {
+    return rval;
+  }
 
-    if (stat == kStatus_ENET_RxFrameError) {
-      /* Release invalid frame */
-      (void)ENET_ReadFrame (ENET, &Emac.h, NULL, 0U, 0U, NULL);
-    }
-  } while (stat == kStatus_ENET_RxFrameError);
+  c = (uint32_t *)&cur;
+  s = (uint32_t *)snapshot;
+  d = (uint32_t *)delta;
+  for (i = 0U; i < (sizeof(EMAC_STATS) / sizeof(uint32_t)); i++) {
+    d[i] = c[i] - s[i];
+    s[i] = c[i];
+  }
 
-  return (len);
+  return ARM_DRIVER_OK;
 }
 
 
@@ -490,8 +4478,31 @@ static uint32_t GetRxFrameSize (void) {
   \return      \ref execution_status
 */
 static int32_t GetRxFrameTime (ARM_ETH_MAC_TIME *time) {
+#if (EMAC_TIMESTAMP != 0)
+  volatile enet_rx_bd_struct_t *bd;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  bd = RxDescFrame ();
+  if (bd == NULL) {
+    /* No frame available */
+    return ARM_DRIVER_ERROR;
+  }
+
+  PtpTimeConvert (bd->timestamp, time);
+
+  return ARM_DRIVER_OK;
+#else
   (void)time;
   return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
@@ -501,8 +4512,42 @@ static int32_t GetRxFrameTime (ARM_ETH_MAC_TIME *time) {
   \return      \ref execution_status
 */
 static int32_t GetTxFrameTime (ARM_ETH_MAC_TIME *time) {
+#if (EMAC_TIMESTAMP != 0)
+  volatile enet_tx_bd_struct_t *bd;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not yet powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (Emac.tx_ts == 0U) {
+    /* No timestamped frame sent */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (Emac.tx_ts_idx >= EMAC_TX_BUF_CNT) {
+    /* Frame queued or fragments pending */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  bd = &Tx_Desc[Emac.tx_ts_idx];
+  if ((bd->control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) != 0U) {
+    /* Frame not yet transmitted */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  PtpTimeConvert (bd->timestamp, time);
+  Emac.tx_ts = 0U;
+
+  return ARM_DRIVER_OK;
+#else
   (void)time;
   return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
@@ -513,7 +4558,13 @@ static int32_t GetTxFrameTime (ARM_ETH_MAC_TIME *time) {
   \return      \ref execution_status
 */
 static int32_t Control (uint32_t control, uint32_t arg) {
+#if (EMAC_RX_CLASS_CNT > 0U)
+  volatile enet_rx_bd_struct_t *bd;
+#else
   uint32_t i;
+#endif
+  uint32_t special;
+  uint32_t primask;
 
   if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
     /* Driver not powered */
@@ -522,6 +4573,7 @@ static int32_t Control (uint32_t control, uint32_t arg) {
 
   switch (control) {
     case ARM_ETH_MAC_CONFIGURE:
+      special = Emac.cfg.macSpecialConfig;
 
       /* Configure link speed */
       switch (arg & ARM_ETH_MAC_SPEED_Msk) {
@@ -576,10 +4628,22 @@ static int32_t Control (uint32_t control, uint32_t arg) {
 
       /* Enable/Disable tx checksum generation */
       if (arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX) {
+        #if (EMAC_TX_CHECKSUM != 0)
         Emac.cfg.txAccelerConfig = kENET_TxAccelIpCheckEnabled | kENET_TxAccelProtoCheckEnabled;
+        #else
+        /* Checksum insertion requires store and forward mode */
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+        #endif
       } else {
         Emac.cfg.txAccelerConfig = 0U;
       }
+      #elif (EMAC_RX_CHECKSUM_SW != 0)
+      if (arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX) {
+        /* Checksum offload is disabled */
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+      }
+      /* Enable/Disable software rx checksum verification */
+      Emac.rx_csum = ((arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX) != 0U) ? 1U : 0U;
       #else
       if (arg & (ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX | ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX)) {
         /* Checksum offload is disabled */
@@ -587,6 +4651,11 @@ static int32_t Control (uint32_t control, uint32_t arg) {
       }
       #endif
 
+      #if (EMAC_RX_SHIFT16 != 0)
+      /* Align IP header in receive buffers */
+      Emac.cfg.rxAccelerConfig |= kENET_RxAccelisShift16Enabled;
+      #endif
+
       /* Enable/Disable broadcast frame receive */
       if (arg & ARM_ETH_MAC_ADDRESS_BROADCAST) {
         Emac.cfg.macSpecialConfig &= ~kENET_ControlRxBroadCastRejectEnable & 0xFFFF;
@@ -595,6 +4664,10 @@ static int32_t Control (uint32_t control, uint32_t arg) {
       }
 
       /* Enable/Disable multicast frame receive */
+      #if (EMAC_MCAST_CNT > 0U)
+      Emac.mc_flt = 0U;
+      Emac.mc_cnt = 0U;
+      #endif
        if (arg & ARM_ETH_MAC_ADDRESS_MULTICAST) {
         ENET->GALR = 0xFFFFFFFFU;
         ENET->GAUR = 0xFFFFFFFFU;
@@ -609,29 +4682,45 @@ static int32_t Control (uint32_t control, uint32_t arg) {
       } else {
         Emac.cfg.macSpecialConfig &= ~kENET_ControlPromiscuousEnable & 0xFFFF;
       }
+      #if (EMAC_UCAST_CNT > 0U)
+      Emac.uc_flt = ((Emac.uc_cnt != 0U) && ((arg & ARM_ETH_MAC_ADDRESS_ALL) == 0U)) ? 1U : 0U;
+      #endif
+
+      #if (EMAC_LINK_MONITOR != 0)
+      /* Configuration from network stack replaces pending link monitor configuration */
+      Emac.link_apply = 0U;
+      #endif
+
+      if (((special ^ Emac.cfg.macSpecialConfig) & kENET_ControlMIILoopEnable) == 0U) {
+        /* Apply configuration to running MAC */
+        if (EnetReconfigure () != 0U) {
+          break;
+        }
+      }
 
       /* Apply configuration */
-      ENET_Init (ENET, &Emac.h, &Emac.cfg, &Emac.desc_cfg, Emac.addr, Emac.pclk);
+      EnetInit ();
 
       /* Disable Rx and Tx interrupts */
-      ENET_DisableInterrupts (ENET, kENET_RxFrameInterrupt | kENET_TxFrameInterrupt);
+      EnetIrqDisable (kENET_RxFrameInterrupt | kENET_TxFrameInterrupt);
       break;
 
     case ARM_ETH_MAC_CONTROL_TX:
       /* Enable/disable MAC transmitter */
       if (arg != 0U) {
-        ENET_EnableInterrupts (ENET, kENET_TxFrameInterrupt);
+        EnetIrqEnable (kENET_TxFrameInterrupt);
       } else {
-        ENET_DisableInterrupts (ENET, kENET_TxFrameInterrupt);
+        EnetIrqDisable (kENET_TxFrameInterrupt);
       }
       break;
 
     case ARM_ETH_MAC_CONTROL_RX:
       /* Enable/disable MAC receiver */
+      Emac.rx_polling = 0U;
       if (arg != 0U) {
-        ENET_EnableInterrupts (ENET, kENET_RxFrameInterrupt);
+        EnetIrqEnable (kENET_RxFrameInterrupt);
       } else {
-        ENET_DisableInterrupts (ENET, kENET_RxFrameInterrupt);
+        EnetIrqDisable (kENET_RxFrameInterrupt);
       }
 
       /* Trigger receive process */
@@ -644,45 +4733,153 @@ static int32_t Control (uint32_t control, uint32_t arg) {
       /* Flush tx and rx buffers */
       if (arg == ARM_ETH_MAC_FLUSH_RX) {
         /* Disable RX interrupts */
-        ENET_DisableInterrupts (ENET, kENET_RxFrameInterrupt);
+        EnetIrqDisable (kENET_RxFrameInterrupt);
 
+#if (EMAC_RX_CLASS_CNT > 0U)
+        /* Drain class queues, descriptors are returned in ring order */
+        while ((bd = RxDescFrame ()) != NULL) {
+          RxFrameRelease (bd);
+        }
+#else
         for (i = 0U; i < EMAC_RX_BUF_CNT; i++) {
           Rx_Desc[i].control |= ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK;
         }
+#if (EMAC_RX_SLAB_CNT > 0U)
+        RxSlabReset ();
+#endif
+#endif
 
         /* Enable RX interrupts */
-        ENET_EnableInterrupts (ENET, kENET_RxFrameInterrupt);
+        Emac.rx_polling = 0U;
+        EnetIrqEnable (kENET_RxFrameInterrupt);
       }
       else {
-        /* Disable TX interrupts */
-        ENET_DisableInterrupts (ENET, kENET_TxFrameInterrupt);
+        /* Stop transmit DMA: frame in progress completes (or is aborted on timeout) */
+        (void)EnetTxStop ();
 
-        for (i = 0; i < EMAC_TX_BUF_CNT; i++) {
-          Tx_Desc[i].control &= ~ENET_BUFFDESCRIPTOR_TX_READY_MASK;
-        }
+        primask = __get_PRIMASK ();
+        __disable_irq ();
+
+        /* Disable MAC, this resets both DMA descriptor pointers to the ring start */
+        ENET->ECR &= ~ENET_ECR_ETHEREN_MASK;
+        ENET->TCR &= ~ENET_TCR_GTS_MASK;
 
-        /* Enable TX interrupts */
-        ENET_EnableInterrupts (ENET, kENET_TxFrameInterrupt);
+        /* Rebase rings, frames not yet sent are discarded */
+        EnetRestart (1U);
+
+        __set_PRIMASK (primask);
       }
       break;
     
     case ARM_ETH_MAC_SLEEP:
       if (arg != 0U) {
-        ENET_EnableInterrupts (ENET, kENET_WakeupInterrupt);
+        EnetIrqEnable (kENET_WakeupInterrupt);
 
         /* Enter sleep mode and wait for magic packet */
         ENET_EnableSleepMode (ENET, true);
       }
       else {
-        ENET_DisableInterrupts (ENET, kENET_WakeupInterrupt);
+        EnetIrqDisable (kENET_WakeupInterrupt);
 
         /* Exit sleep mode */
         ENET_EnableSleepMode (ENET, false);
       }
       break;
 
+#if (EMAC_COALESCE != 0)
+    case EMAC_CONTROL_RX_COALESCE:
+      /* Set receive interrupt coalescing */
+      Emac.ic_adapt = 0U;
+      Emac.rx_ic    = CoalesceReg (arg & 0xFFU, arg >> 16);
+      CoalesceApply ();
+      break;
+
+    case EMAC_CONTROL_TX_COALESCE:
+      /* Set transmit interrupt coalescing */
+      Emac.tx_ic    = CoalesceReg (arg & 0xFFU, arg >> 16);
+      CoalesceApply ();
+      break;
+
+    case EMAC_CONTROL_RX_COALESCE_ADAPTIVE:
+      /* Enable/disable adaptive receive interrupt coalescing */
+      Emac.rx_ic = 0U;
+      if (((arg & 0xFFU) > 1U) && ((arg >> 16) != 0U)) {
+        Emac.ic_max    = (uint8_t)(arg & 0xFFU);
+        Emac.ic_usec   = (uint16_t)(arg >> 16);
+#if (EMAC_CYCLE_DWT != 0)
+        /* Interrupt spacing is measured with the DWT cycle counter */
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+        Emac.ic_frames = 1U;
+        Emac.ic_cnt    = Emac.rx_cnt;
+        Emac.ic_time   = EMAC_CYCLE_COUNT ();
+        Emac.ic_hold   = 0U;
+        Emac.ic_adapt  = 1U;
+      } else {
+        Emac.ic_adapt  = 0U;
+      }
+      CoalesceApply ();
+      break;
+#endif
+
+    case EMAC_CONTROL_FLOW_CONTROL:
+      /* Configure IEEE 802.3x flow control */
+      Emac.fc_quanta = (uint16_t)arg;
+      Emac.fc_empty  = (uint8_t)(arg >> 16);
+      Emac.fc_full   = (uint8_t)(arg >> 24);
+      if ((Emac.fc_quanta != 0U) && (Emac.fc_empty == 0U)) {
+        /* Pause frame generation requires empty threshold */
+        Emac.fc_quanta = 0U;
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      FlowApply ();
+      break;
+
+    case EMAC_CONTROL_RX_POLL:
+      /* Enable/disable adaptive interrupt/poll receive mode */
+      Emac.rx_poll = (arg != 0U) ? 1U : 0U;
+      if ((Emac.rx_poll == 0U) && (Emac.rx_polling != 0U)) {
+        /* Leave poll mode */
+        Emac.rx_polling = 0U;
+        EnetIrqEnable (kENET_RxFrameInterrupt);
+      }
+      break;
+
     case ARM_ETH_MAC_VLAN_FILTER:
-      /* VLAN filtering is not supported */
+      /* Set exact VLAN filter */
+      Emac.vlan_tag  = (uint16_t)arg;
+      Emac.vlan_mask = (arg & ARM_ETH_MAC_VLAN_FILTER_ID_ONLY) ? 0x0FFFU : 0xFFFFU;
+      if ((uint16_t)arg == 0U) {
+        /* Disable exact VLAN filter */
+        Emac.vlan_mask = 0U;
+      }
+      Emac.vlan_tag &= Emac.vlan_mask;
+      Emac.vlan_flt  = ((Emac.vlan_mask != 0U) || (Emac.vlan_cnt != 0U)) ? 1U : 0U;
+      break;
+
+#if (EMAC_VLAN_SET != 0)
+    case EMAC_CONTROL_VLAN_ADD:
+    case EMAC_CONTROL_VLAN_REMOVE:
+      /* Add/remove VLAN ID to/from VLAN ID set */
+      if (arg > 0x0FFFU) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      if (control == EMAC_CONTROL_VLAN_ADD) {
+        if ((Vlan_Map[arg >> 5] & (1UL << (arg & 0x1FU))) == 0U) {
+          Vlan_Map[arg >> 5] |= (1UL << (arg & 0x1FU));
+          Emac.vlan_cnt++;
+        }
+      } else {
+        if ((Vlan_Map[arg >> 5] & (1UL << (arg & 0x1FU))) != 0U) {
+          Vlan_Map[arg >> 5] &= ~(1UL << (arg & 0x1FU));
+          Emac.vlan_cnt--;
+        }
+      }
+      Emac.vlan_flt = ((Emac.vlan_mask != 0U) || (Emac.vlan_cnt != 0U)) ? 1U : 0U;
+      break;
+#endif
+
     default:
       return ARM_DRIVER_ERROR_UNSUPPORTED;
   }
@@ -697,9 +4894,101 @@ static int32_t Control (uint32_t control, uint32_t arg) {
   \return      \ref execution_status
 */
 static int32_t ControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
+#if (EMAC_TIMESTAMP != 0)
+  enet_ptp_time_t t;
+  uint32_t primask;
+
+  if (time == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  switch (control) {
+    case ARM_ETH_MAC_TIMER_GET_TIME:
+      /* Get current time */
+      ENET_Ptp1588GetTimer (ENET, &Emac.h, &t);
+      time->sec = (uint32_t)t.second;
+      time->ns  = t.nanosecond;
+      break;
+
+    case ARM_ETH_MAC_TIMER_SET_TIME:
+      /* Set new time */
+      if (time->ns >= 1000000000U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      t.second     = time->sec;
+      t.nanosecond = time->ns;
+      ENET_Ptp1588SetTimer (ENET, &Emac.h, &t);
+      break;
+
+    case ARM_ETH_MAC_TIMER_INC_TIME:
+    case ARM_ETH_MAC_TIMER_DEC_TIME:
+      /* Increment/decrement current time */
+      if (time->ns >= 1000000000U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      primask = __get_PRIMASK ();
+      __disable_irq ();
+      ENET_Ptp1588GetTimer (ENET, &Emac.h, &t);
+      if (control == ARM_ETH_MAC_TIMER_INC_TIME) {
+        t.second     += time->sec;
+        t.nanosecond += time->ns;
+        if (t.nanosecond >= 1000000000U) {
+          t.nanosecond -= 1000000000U;
+          t.second++;
+        }
+      } else {
+        t.second -= time->sec;
+        if (t.nanosecond < time->ns) {
+          t.nanosecond += 1000000000U;
+          t.second--;
+        }
+        t.nanosecond -= time->ns;
+      }
+      ENET_Ptp1588SetTimer (ENET, &Emac.h, &t);
+      __set_PRIMASK (primask);
+      break;
+
+    case ARM_ETH_MAC_TIMER_SET_ALARM:
+#if (EMAC_PTP_ALARM != 0)
+      /* Set alarm time (0 disables alarm) */
+      if (time->ns >= 1000000000U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      primask = __get_PRIMASK ();
+      __disable_irq ();
+      Emac.alarm_sec = time->sec;
+      Emac.alarm_ns  = time->ns;
+      Emac.alarm     = ((time->sec | time->ns) != 0U) ? 1U : 0U;
+      PtpAlarmArm ();
+      __set_PRIMASK (primask);
+      break;
+#else
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+    case ARM_ETH_MAC_TIMER_ADJUST_CLOCK:
+      /* Adjust clock frequency, time->ns is correction factor in Q31 format */
+      if (time->ns == 0U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      PtpSetRate (time->ns);
+      break;
+
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  return ARM_DRIVER_OK;
+#else
   (void)control;
   (void)time;
   return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
 }
 
 /**
@@ -711,7 +5000,12 @@ static int32_t ControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
   \return      \ref execution_status
 */
 static int32_t PHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  MDIO_WAIT wait;
+  int32_t   rval;
+#else
   uint32_t loop;
+#endif
 
   if (data == NULL) {
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -721,6 +5015,26 @@ static int32_t PHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
     /* Driver not powered */
     return ARM_DRIVER_ERROR;
   }
+
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  wait.xfer.phy_addr = phy_addr;
+  wait.xfer.reg_addr = reg_addr;
+  wait.xfer.write    = 0U;
+  wait.xfer.data     = 0U;
+
+  rval = MdioTransfer (&wait);
+  if (rval == ARM_DRIVER_OK) {
+    *data = wait.xfer.data;
+  }
+  return (rval);
+#else
+#if (EMAC_PHY_CACHE_REGS != 0U)
+  if (PhyCacheRead (phy_addr, reg_addr, data) != 0U) {
+    /* Cached register */
+    return ARM_DRIVER_OK;
+  }
+#endif
+
   /* Clear MII Interrupt flag */
   ENET_ClearInterruptStatus(ENET, kENET_MiiInterrupt);
 
@@ -737,8 +5051,12 @@ static int32_t PHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
   }
 
   *data = (uint16_t)ENET_ReadSMIData (ENET);
+#if (EMAC_PHY_CACHE_REGS != 0U)
+  PhyCacheUpdate (phy_addr, reg_addr, *data);
+#endif
 
   return ARM_DRIVER_OK;
+#endif
 }
 
 /**
@@ -750,12 +5068,27 @@ static int32_t PHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
   \return      \ref execution_status
 */
 static int32_t PHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  MDIO_WAIT wait;
+  int32_t   rval;
+#else
   uint32_t loop;
+#endif
 
   if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
     /* Driver not powered */
     return ARM_DRIVER_ERROR;
   }
+
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+  wait.xfer.phy_addr = phy_addr;
+  wait.xfer.reg_addr = reg_addr;
+  wait.xfer.write    = 1U;
+  wait.xfer.data     = data;
+
+  rval = MdioTransfer (&wait);
+  return (rval);
+#else
   /* Clear MII Interrupt flag */
   ENET_ClearInterruptStatus(ENET, kENET_MiiInterrupt);
 
@@ -770,36 +5103,350 @@ static int32_t PHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
       return ARM_DRIVER_ERROR;
     }
   }
+#if (EMAC_PHY_CACHE_REGS != 0U)
+  PhyCacheUpdate (phy_addr, reg_addr, data);
+#endif
+  return ARM_DRIVER_OK;
+#endif
+}
+
+/**
+  \fn          int32_t EMAC_LinkMonitor (uint32_t phy_addr, uint32_t enable)
+  \brief       Enable or disable interrupt driven PHY link monitor.
+  \param[in]   phy_addr  5-bit PHY address
+  \param[in]   enable    0 = disable, 1 = enable link monitor
+  \return      \ref execution_status
+*/
+int32_t EMAC_LinkMonitor (uint32_t phy_addr, uint32_t enable) {
+#if (EMAC_LINK_MONITOR != 0)
+  int32_t rval;
+
+  if (phy_addr > 31U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    /* Driver not powered */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (enable == 0U) {
+    (void)Driver_GPIO0.SetEventTrigger (EMAC_PHY_INT_PIN, ARM_GPIO_TRIGGER_NONE);
+    return (PHY_Write ((uint8_t)phy_addr, EMAC_PHY_INT_REG, 0U));
+  }
+
+  Emac.link_phy   = (uint8_t)phy_addr;
+  Emac.link_state = ARM_ETH_LINK_DOWN;
+
+  /* Enable link up/down interrupts in PHY */
+  rval = PHY_Write ((uint8_t)phy_addr, EMAC_PHY_INT_REG, EMAC_PHY_INT_ENABLE);
+  if (rval != ARM_DRIVER_OK) {
+    return (rval);
+  }
+
+  /* PHY interrupt line: input, active low */
+  if ((Driver_GPIO0.Setup (EMAC_PHY_INT_PIN, LinkSignalEvent) != ARM_DRIVER_OK)            ||
+      (Driver_GPIO0.SetDirection (EMAC_PHY_INT_PIN, ARM_GPIO_INPUT) != ARM_DRIVER_OK)      ||
+      (Driver_GPIO0.SetPullResistor (EMAC_PHY_INT_PIN, ARM_GPIO_PULL_UP) != ARM_DRIVER_OK) ||
+      (Driver_GPIO0.SetEventTrigger (EMAC_PHY_INT_PIN, ARM_GPIO_TRIGGER_FALLING_EDGE) != ARM_DRIVER_OK)) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  /* Read initial link state (also clears pending PHY interrupt) */
+  LinkSignalEvent (EMAC_PHY_INT_PIN, 0U);
+
   return ARM_DRIVER_OK;
+#else
+  (void)phy_addr;
+  (void)enable;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+
+/**
+  \fn          ARM_ETH_LINK_STATE EMAC_GetLinkState (ARM_ETH_LINK_INFO *info)
+  \brief       Get link state tracked by PHY link monitor.
+  \param[out]  info  Pointer to link information (speed and duplex mode), can be NULL
+  \return      \ref ARM_ETH_LINK_STATE
+*/
+ARM_ETH_LINK_STATE EMAC_GetLinkState (ARM_ETH_LINK_INFO *info) {
+#if (EMAC_LINK_MONITOR != 0)
+  LinkApply ();
+
+  if (info != NULL) {
+    info->speed  = Emac.link_speed;
+    info->duplex = Emac.link_duplex;
+  }
+  return ((ARM_ETH_LINK_STATE)Emac.link_state);
+#else
+  (void)info;
+  return ARM_ETH_LINK_DOWN;
+#endif
+}
+
+#if (EMAC_MDIO_QUEUE_LEN > 0U)
+/**
+  \fn          void ENET_IRQHandler (void)
+  \brief       ENET interrupt handler: complete MDIO transactions, forward other events to SDK handler.
+*/
+void ENET_IRQHandler (void) {
+
+  if ((ENET_GetInterruptStatus (ENET) & ENET->EIMR & kENET_MiiInterrupt) != 0U) {
+    if (Emac.mdio_cnt != 0U) {
+      MdioComplete ();
+    } else {
+      ENET_ClearInterruptStatus (ENET, kENET_MiiInterrupt);
+    }
+  }
+
+  ENET_DriverIRQHandler ();
+}
+#endif
+
+#if (EMAC_PTP_ALARM != 0)
+/**
+  \fn          void ENET_1588_Timer_IRQHandler (void)
+  \brief       ENET 1588 timer interrupt handler: signal timer alarm, forward other events to SDK handler.
+*/
+void ENET_1588_Timer_IRQHandler (void) {
+
+  if (ENET_Ptp1588GetChannelStatus (ENET, EMAC_ALARM_CHANNEL)) {
+    /* Alarm compare event */
+    ENET_Ptp1588SetChannelMode (ENET, EMAC_ALARM_CHANNEL, kENET_PtpChannelDisable, false);
+    ENET_Ptp1588ClearChannelStatus (ENET, EMAC_ALARM_CHANNEL);
+    if (Emac.alarm != 0U) {
+      Emac.alarm = 0U;
+      SignalEvent (ARM_ETH_MAC_EVENT_TIMER_ALARM);
+    }
+  }
+
+  ENET_1588_Timer_DriverIRQHandler ();
+}
+#endif
+
+/**
+  \fn          void RxIrqTrack (void)
+  \brief       Receive interrupt bookkeeping: latency timestamps, ring full probe and adaptive coalescing.
+  \note        Called from ENET interrupt or from event thread with ENET interrupt masked.
+*/
+static void RxIrqTrack (void) {
+
+#if (EMAC_LATENCY != 0)
+  LatencyRxStamp (EMAC_RX_IRQ_TIME ());
+#endif
+  if ((Rx_Desc[(Emac.rx_idx + EMAC_RX_BUF_CNT - 1U) % EMAC_RX_BUF_CNT].control &
+       ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) == 0U) {
+    /* All receive descriptors filled */
+    Stats.rx_ring_full++;
+  }
+#if (EMAC_COALESCE != 0)
+  if (Emac.ic_adapt != 0U) {
+    CoalesceAdapt (EMAC_RX_IRQ_TIME ());
+  }
+#endif
+}
+
+/**
+  \fn          uint32_t RxEventProcess (void)
+  \brief       Process receive interrupt event.
+  \return      events to signal
+  \note        Called from ENET interrupt or from event thread with ENET interrupt masked.
+*/
+static uint32_t RxEventProcess (void) {
+#if (EMAC_RX_CLASS_CNT > 0U)
+  uint32_t cls;
+
+  /* Classify received frames, signal classes which received frames */
+  cls = RxClassScan ();
+  return ((cls != 0U) ? (ARM_ETH_MAC_EVENT_RX_FRAME | (cls << 16)) : 0U);
+#else
+#if (EMAC_RX_SLAB_CNT > 0U)
+  /* Copy small frames, their descriptors are available again before the reader runs */
+  RxSlabFill ();
+#endif
+  return (ARM_ETH_MAC_EVENT_RX_FRAME);
+#endif
+}
+
+/**
+  \fn          uint32_t TxEventProcess (void)
+  \brief       Process transmit interrupt event.
+  \return      events to signal
+  \note        Called from ENET interrupt or from event thread with ENET interrupt masked.
+*/
+static uint32_t TxEventProcess (void) {
+  uint32_t event = ARM_ETH_MAC_EVENT_TX_FRAME;
+
+#if (EMAC_TX_ZERO_COPY == 0)
+  /* Reclaim transmitted descriptors and send queued frames */
+  TxReclaim ();
+  TxSubmit ();
+#if (EMAC_TX_QUEUE_LEN != 0U)
+  if ((Emac.tx_wm != 0U) && ((Emac.tx_qcnt + Emac.tx_dcnt) <= EMAC_TX_QUEUE_LOW)) {
+    /* Low watermark reached */
+    Emac.tx_wm = 0U;
+    event |= EMAC_EVENT_TX_QUEUE_LOW;
+  }
+#endif
+#endif
+  return (event);
 }
 
+#if (EMAC_EVENT_THREAD != 0)
+/**
+  \fn          void EventThread (void *arg)
+  \brief       Event thread: process events posted from interrupt and signal them in batches.
+  \param[in]   arg  Not used
+*/
+static void EventThread (void *arg) {
+  uint32_t event, get, val, irq;
+  int32_t  lock;
+
+  (void)arg;
+
+  for (;;) {
+#if (EMAC_STATS_PERIOD != 0U)
+    /* Wake up at least once per statistics period */
+    (void)osThreadFlagsWait (1U, osFlagsWaitAny, (EMAC_STATS_PERIOD * osKernelGetTickFreq ()) / 1000U);
+    if ((Emac.flags & EMAC_FLAG_POWER) != 0U) {
+      StatsPoll ();
+    }
+#else
+    (void)osThreadFlagsWait (1U, osFlagsWaitAny, osWaitForever);
+#endif
+
+    /* Collect pending event records */
+    event = 0U;
+    get   = Emac.ev_get;
+    while (get != Emac.ev_put) {
+      __DMB ();
+      event |= Ev_Queue[get & (EMAC_EVENT_QUEUE_LEN - 1U)];
+      get++;
+    }
+    __DMB ();
+    Emac.ev_get = get;
+
+    /* Collect events posted outside of the ENET interrupt */
+    do {
+      val = __LDREXW (&Emac.ev_flags);
+    } while (__STREXW (0U, &Emac.ev_flags) != 0U);
+    event |= val;
+
+    if ((event & (ARM_ETH_MAC_EVENT_RX_FRAME | ARM_ETH_MAC_EVENT_TX_FRAME)) != 0U) {
+      /* Exclude ENET interrupt and driver calls from other threads, other interrupts stay enabled */
+      lock = osKernelLock ();
+      irq  = NVIC_GetEnableIRQ (ENET_IRQn);
+      NVIC_DisableIRQ (ENET_IRQn);
+      __DSB ();
+      __ISB ();
+      if ((event & ARM_ETH_MAC_EVENT_RX_FRAME) != 0U) {
+        if (Emac.ev_rx_pend != 0U) {
+          /* Receive interrupt bookkeeping, moved out of the ENET interrupt */
+          RxIrqTrack ();
+          Emac.ev_rx_pend = 0U;
+        }
+        event = (event & ~ARM_ETH_MAC_EVENT_RX_FRAME) | RxEventProcess ();
+      }
+      if ((event & ARM_ETH_MAC_EVENT_TX_FRAME) != 0U) {
+#if (EMAC_LATENCY != 0)
+        if (Emac.ev_tx_pend != 0U) {
+          LatencyTxDone (Emac.ev_tx_time);
+          Emac.ev_tx_pend = 0U;
+        }
+#endif
+        event |= TxEventProcess ();
+      }
+      if (irq != 0U) {
+        NVIC_EnableIRQ (ENET_IRQn);
+      }
+      (void)osKernelRestoreLock (lock);
+    }
+
+#if (EMAC_LINK_MONITOR != 0)
+    if ((event & EMAC_EVENT_LINK_CHANGE) != 0U) {
+      LinkApply ();
+    }
+#endif
+
+    if ((event != 0U) && (Emac.cb_event != NULL)) {
+      Emac.cb_event (event);
+    }
+  }
+}
+#endif
 
 static void ENET_IRQCallback (ENET_Type *base, enet_handle_t *handle, enet_event_t event, enet_frame_info_t *frameInfo, void *userData) {
+#if (EMAC_EVENT_THREAD != 0)
+  uint32_t cycles = EMAC_CYCLE_COUNT ();
+#endif
   (void)base;
   (void)handle;
   (void)frameInfo;
   (void)userData;
 
+#if (EMAC_STATS_PERIOD != 0U) && (EMAC_EVENT_THREAD == 0)
+  StatsPoll ();
+#endif
+
   if (event == kENET_RxEvent) {
-    /* Receive event */
-    if (Emac.cb_event) {
-      Emac.cb_event (ARM_ETH_MAC_EVENT_RX_FRAME);
+    Stats.rx_irq++;
+    if (Emac.rx_poll != 0U) {
+      /* Mask receive interrupt, network stack polls until receive ring is drained */
+      EnetIrqDisable (kENET_RxFrameInterrupt);
+      Emac.rx_polling = 1U;
+    }
+#if (EMAC_EVENT_THREAD != 0)
+    /* Receive event, bookkeeping and processing in event thread with the time of the first interrupt */
+    if (Emac.ev_rx_pend == 0U) {
+      Emac.ev_rx_time = cycles;
+      Emac.ev_rx_pend = 1U;
     }
+    EventPut (ARM_ETH_MAC_EVENT_RX_FRAME);
+#else
+    /* Receive event */
+    RxIrqTrack ();
+    SignalEvent (RxEventProcess ());
+#endif
   }
   else if (event == kENET_TxEvent) {
-    /* Transmit event */
-    if (Emac.cb_event) {
-      Emac.cb_event (ARM_ETH_MAC_EVENT_TX_FRAME);
+#if (EMAC_EVENT_THREAD != 0)
+    /* Transmit event, processed in event thread */
+#if (EMAC_LATENCY != 0)
+    if (Emac.ev_tx_pend == 0U) {
+      Emac.ev_tx_time = cycles;
+      Emac.ev_tx_pend = 1U;
     }
+#endif
+    EventPut (ARM_ETH_MAC_EVENT_TX_FRAME);
+#else
+#if (EMAC_LATENCY != 0)
+    LatencyTxDone (EMAC_CYCLE_COUNT ());
+#endif
+    /* Transmit event */
+    SignalEvent (TxEventProcess ());
+#endif
   }
   else {
     if (event == kENET_WakeUpEvent) {
       /* Wake up from sleep mode */
-      if (Emac.cb_event) {
-        Emac.cb_event (ARM_ETH_MAC_EVENT_WAKEUP);
+      SignalEvent (ARM_ETH_MAC_EVENT_WAKEUP);
+    }
+#if (EMAC_PTP_ALARM != 0)
+    else if (event == kENET_TimeStampEvent) {
+      /* Seconds counter incremented, arm compare channel in the alarm second */
+      if (Emac.alarm != 0U) {
+        PtpAlarmArm ();
       }
     }
+#endif
+  }
+
+#if (EMAC_EVENT_THREAD != 0)
+  cycles = EMAC_CYCLE_COUNT () - cycles;
+  if (cycles > Stats.isr_cycles) {
+    Stats.isr_cycles = cycles;
   }
+#endif
 }
 
 
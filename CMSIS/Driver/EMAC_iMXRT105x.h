@@ -27,6 +27,7 @@
 #define EMAC_IMXRT105x_H__
 
 #include <string.h>
+#include <stddef.h>
 
 #include "Driver_ETH_MAC.h"
 
@@ -45,6 +46,123 @@
 #define EMAC_FLAG_INIT     (1U << 0)        // Driver initialized
 #define EMAC_FLAG_POWER    (1U << 1)        // Driver power on
 
+/* EMAC Driver extended control codes */
+#define EMAC_CONTROL_RX_COALESCE          (0x80UL)  // Receive interrupt coalescing; arg = EMAC_COALESCE_ARG
+#define EMAC_CONTROL_TX_COALESCE          (0x81UL)  // Transmit interrupt coalescing; arg = EMAC_COALESCE_ARG
+#define EMAC_CONTROL_RX_COALESCE_ADAPTIVE (0x82UL)  // Adaptive receive interrupt coalescing; arg = EMAC_COALESCE_ARG
+#define EMAC_CONTROL_VLAN_ADD             (0x83UL)  // Add VLAN ID to VLAN ID set filter; arg = VLAN ID
+#define EMAC_CONTROL_VLAN_REMOVE          (0x84UL)  // Remove VLAN ID from VLAN ID set filter; arg = VLAN ID
+#define EMAC_CONTROL_RX_POLL              (0x85UL)  // Adaptive interrupt/poll receive mode; arg: 0=disabled, 1=enabled
+#define EMAC_CONTROL_FLOW_CONTROL         (0x86UL)  // IEEE 802.3x flow control; arg = EMAC_FLOW_CONTROL_ARG
+
+/* Interrupt coalescing argument: frame count threshold (1..255) and timer threshold in microseconds */
+#define EMAC_COALESCE_ARG(frames, usec)   (((uint32_t)(frames) & 0xFFU) | (((uint32_t)(usec) & 0xFFFFU) << 16))
+
+/* Flow control argument: pause quanta, receive FIFO section empty (XOFF) and full thresholds in 64-bit words */
+#define EMAC_FLOW_CONTROL_ARG(quanta, empty, full) \
+  (((uint32_t)(quanta) & 0xFFFFU) | (((uint32_t)(empty) & 0xFFU) << 16) | (((uint32_t)(full) & 0xFFU) << 24))
+
+/* EMAC Driver extended events */
+#define EMAC_EVENT_TX_QUEUE_HIGH  (1UL << 8)  // Transmit queue reached high watermark
+#define EMAC_EVENT_TX_QUEUE_LOW   (1UL << 9)  // Transmit queue dropped to low watermark
+#define EMAC_EVENT_LINK_CHANGE    (1UL << 10) // PHY link state changed (EMAC_GetLinkState)
+#define EMAC_EVENT_RX_CLASS(n)    (1UL << (16U + (n))) // Frames received in receive class n
+
+/* Latency histograms (EMAC_GetLatency) */
+#define EMAC_LATENCY_RX_READ      (0U)      // Receive interrupt until frame read
+#define EMAC_LATENCY_TX_SEND      (1U)      // SendFrame entry until frame handed over to DMA
+#define EMAC_LATENCY_TX_DONE      (2U)      // SendFrame entry until transmit completed interrupt
+#define EMAC_LATENCY_BINS         (32U)     // Bin n counts intervals from 2^n to 2^(n+1)-1 ticks
+
+/* Receive classification rule match flags */
+#define EMAC_RX_MATCH_ETHERTYPE   (1U << 0) // Match ethertype (after VLAN tag)
+#define EMAC_RX_MATCH_PCP         (1U << 1) // Match VLAN priority greater or equal to pcp
+#define EMAC_RX_MATCH_DST_ADDR    (1U << 2) // Match destination MAC address
+
+
+/* MDIO transaction status */
+#define EMAC_MDIO_DONE            (0U)      // Transaction completed
+#define EMAC_MDIO_PENDING         (1U)      // Transaction queued or in progress
+#define EMAC_MDIO_ERROR           (2U)      // Transaction aborted
+
+/* MDIO transaction */
+typedef struct _EMAC_MDIO_XFER {
+  uint8_t                   phy_addr;       // 5-bit PHY address
+  uint8_t                   reg_addr;       // 5-bit register address
+  uint8_t                   write;          // 0 = read, 1 = write
+  volatile uint8_t          status;         // Transaction status (EMAC_MDIO_...)
+  uint16_t                  data;           // Data to write or data read
+  void                    (*cb_done)(struct _EMAC_MDIO_XFER *xfer); // Completion callback (can be NULL)
+} EMAC_MDIO_XFER;
+
+/* Receive classification rule */
+typedef struct _EMAC_RX_RULE {
+  uint8_t                   match;          // Match flags (EMAC_RX_MATCH_...), 0 = rule disabled
+  uint8_t                   cls;            // Receive class of matching frames
+  uint16_t                  ethertype;      // Ethertype
+  uint8_t                   pcp;            // Minimum VLAN priority (0..7)
+  uint8_t                   addr[6];        // Destination MAC address
+} EMAC_RX_RULE;
+
+/* Frame buffer for EMAC_ReadFrames */
+typedef struct _EMAC_FRAME {
+  uint8_t                  *data;           // Pointer to frame buffer
+  uint32_t                  len;            // Buffer size (in), number of data bytes read (out)
+} EMAC_FRAME;
+
+/* Frame capture ring (one producer at a time, single consumer) */
+typedef struct _EMAC_CAP_RING {
+  uint32_t                  pos;            // Record write position
+  uint32_t                  rem;            // Record bytes remaining
+  volatile uint32_t         head;           // Write index (producer)
+  volatile uint32_t         tail;           // Read index (consumer)
+  uint16_t                  cnt;            // Sampling counter
+  uint8_t                   busy;           // Record being written (other producers skip their frame)
+} EMAC_CAP_RING;
+
+/* EMAC statistics (ENET MIB counters extended to 32-bit and driver counters) */
+typedef struct _EMAC_STATS {
+  uint32_t                  tx_frames;      // Transmitted frames
+  uint32_t                  tx_broadcast;   // Transmitted broadcast frames
+  uint32_t                  tx_multicast;   // Transmitted multicast frames
+  uint32_t                  tx_octets;      // Transmitted octets
+  uint32_t                  tx_frames_ok;   // Frames transmitted without error
+  uint32_t                  tx_single_col;  // Frames transmitted after single collision
+  uint32_t                  tx_multi_col;   // Frames transmitted after multiple collisions
+  uint32_t                  tx_deferred;    // Frames transmitted after deferral
+  uint32_t                  tx_late_col;    // Frames with late collision
+  uint32_t                  tx_excess_col;  // Frames with excessive collisions
+  uint32_t                  tx_underrun;    // Frames with transmit FIFO underrun
+  uint32_t                  tx_carrier_err; // Frames with carrier sense error
+  uint32_t                  tx_pause;       // Transmitted pause frames
+  uint32_t                  rx_frames;      // Received frames
+  uint32_t                  rx_broadcast;   // Received broadcast frames
+  uint32_t                  rx_multicast;   // Received multicast frames
+  uint32_t                  rx_octets;      // Received octets
+  uint32_t                  rx_frames_ok;   // Frames received without error
+  uint32_t                  rx_crc_err;     // Frames received with CRC error
+  uint32_t                  rx_align_err;   // Frames received with alignment error
+  uint32_t                  rx_undersize;   // Undersize frames with good CRC
+  uint32_t                  rx_oversize;    // Oversize frames with good CRC
+  uint32_t                  rx_fragments;   // Undersize frames with bad CRC
+  uint32_t                  rx_jabbers;     // Oversize frames with bad CRC
+  uint32_t                  rx_overrun;     // Frames with receive FIFO overflow
+  uint32_t                  rx_dropped;     // Frames dropped by MAC
+  uint32_t                  rx_pause;       // Received pause frames
+  uint32_t                  rx_ring_full;   // Receive interrupts with all descriptors filled
+  uint32_t                  rx_err_drop;    // Received frames dropped by driver (error or too long)
+  uint32_t                  rx_vlan_drop;   // Received frames rejected by VLAN filter
+  uint32_t                  rx_mcast_drop;  // Received frames rejected by exact multicast filter
+  uint32_t                  rx_ucast_drop;  // Received frames rejected by exact unicast filter
+  uint32_t                  rx_csum_drop;   // Received frames with software checksum error
+  uint32_t                  tx_busy;        // SendFrame calls returned busy
+  uint32_t                  tx_frag_copy;   // Transmit fragments copied into frame buffer
+  uint32_t                  rx_irq;         // Receive interrupts
+  uint32_t                  cap_drop;       // Frames not captured (capture ring full)
+  uint32_t                  ev_overflow;    // Events merged because event queue was full
+  uint32_t                  isr_cycles;     // Longest ENET interrupt callback in CPU cycles
+  uint32_t                  rx_class_move;  // Pending class frames moved to free the receive ring head
+} EMAC_STATS;
 
 /* EMAC Driver Control Information */
 typedef struct _EMAC_INFO {
@@ -55,9 +173,254 @@ typedef struct _EMAC_INFO {
   enet_config_t             cfg;            // Configuration address
   enet_buffer_config_t      desc_cfg;       // DMA descriptor configuration
   enet_handle_t             h;              // ENET handle
+  uint16_t                  rx_idx;         // Current receive descriptor index
+  uint8_t                   rx_skip;        // Discard multi-buffer frame
+  uint16_t                  tx_idx;         // Next transmit descriptor index
+  uint16_t                  tx_cidx;        // Next transmit descriptor to reclaim
+  uint16_t                  tx_first;       // First descriptor of pending frame
+  uint16_t                  tx_frag;        // Number of pending frame fragments
+  uint8_t                   tx_frag_ts;     // Pending fragments request transmit timestamp
+  uint16_t                  tx_put;         // Frame slot being filled
+  uint16_t                  tx_sub;         // Next frame slot to submit
+  uint16_t                  tx_qcnt;        // Number of queued frames
+  uint16_t                  tx_dcnt;        // Number of descriptors in transmission
+  uint8_t                   tx_wm;          // Transmit queue above high watermark
+  uint32_t                  tx_len;         // Pending frame length (copy mode)
+  uint32_t                  rx_cnt;         // Number of released receive descriptors
+  uint32_t                  rx_ic;          // Receive interrupt coalescing register
+  uint32_t                  tx_ic;          // Transmit interrupt coalescing register
+  uint32_t                  ic_cnt;         // Adaptive coalescing: rx_cnt at last interrupt
+  uint32_t                  ic_time;        // Adaptive coalescing: EMAC_CYCLE_COUNT at last interrupt
+  uint16_t                  ic_usec;        // Adaptive coalescing: maximum delay in us
+  uint8_t                   ic_frames;      // Adaptive coalescing: current frame threshold
+  uint8_t                   ic_max;         // Adaptive coalescing: maximum frame threshold
+  uint8_t                   ic_hold;        // Adaptive coalescing: skip next evaluation after a change
+  uint8_t                   ic_adapt;       // Adaptive coalescing enabled
+  uint8_t                   tx_ts;          // Transmit timestamp pending
+  uint16_t                  tx_ts_idx;      // Transmit timestamp descriptor index
+  uint8_t                   alarm;          // Timer alarm enabled
+  uint32_t                  alarm_sec;      // Timer alarm seconds
+  uint32_t                  alarm_ns;       // Timer alarm nanoseconds
+  uint8_t                   vlan_flt;       // VLAN filter active
+  uint16_t                  vlan_tag;       // Exact VLAN filter tag
+  uint16_t                  vlan_mask;      // Exact VLAN filter mask (0 = disabled)
+  uint16_t                  vlan_cnt;       // Number of VLAN IDs in set
+  uint8_t                   mc_flt;         // Exact multicast filter active
+  uint8_t                   mc_cnt;         // Number of addresses in exact multicast table
+  uint32_t                  mc_fp;          // Multicast hash filter false positives
+  uint8_t                   uc_flt;         // Exact unicast filter active
+  uint8_t                   uc_cnt;         // Number of additional unicast addresses
+  uint8_t                   rx_poll;        // Adaptive interrupt/poll receive mode enabled
+  volatile uint8_t          rx_polling;     // Receive interrupt masked, stack is polling
+  uint8_t                   rx_csum;        // Software receive checksum verification enabled
+  void                     *ev_thread;      // Event thread ID
+  volatile uint32_t         ev_put;         // Event queue write index (ENET interrupt)
+  volatile uint32_t         ev_get;         // Event queue read index (event thread)
+  volatile uint32_t         ev_flags;       // Events posted outside of the ENET interrupt
+  uint32_t                  ev_rx_time;     // First receive interrupt not yet processed (EMAC_CYCLE_COUNT)
+  uint32_t                  ev_tx_time;     // First transmit interrupt not yet processed (EMAC_CYCLE_COUNT)
+  volatile uint8_t          ev_rx_pend;     // Receive interrupt time valid
+  volatile uint8_t          ev_tx_pend;     // Transmit interrupt time valid
+  uint16_t                  lat_rx_idx;     // Latency: next receive descriptor to timestamp
+  uint16_t                  lat_tx_idx;     // Latency: next transmit descriptor to check for completion
+  uint32_t                  lat_tx_t0;      // Latency: SendFrame entry of current frame
+  volatile uint8_t          cap_on;         // Frame capture enabled
+  uint16_t                  cap_snap;       // Frame capture snap length
+  uint16_t                  cap_sample;     // Frame capture sampling rate (every n-th frame)
+  EMAC_CAP_RING             cap[2];         // Frame capture rings (receive, transmit)
+  uint16_t                  rx_scan;        // Receive class: next descriptor to classify
+  uint16_t                  rx_held;        // Receive class: descriptors classified but not returned
+  uint16_t                  rx_cur;         // Receive class: selected descriptor index + 1 (0 = none)
+  uint16_t                  rx_pin;         // Receive class: descriptor being read index + 1 (0 = none)
+  uint16_t                  slab_get;       // Slab queue: position of oldest frame   
+  uint16_t                  slab_qcnt;      // Slab queue: number of frames copied at receive time
+  volatile uint8_t          rx_own;         // Reader holds receive ring head (no slab copy)
+  uint16_t                  fc_quanta;      // Flow control pause quanta (0 = disabled)
+  uint32_t                  stats_time;     // Last periodic MIB counter accumulation (EMAC_CYCLE_COUNT)
+  uint8_t                   fc_empty;       // Flow control receive FIFO section empty threshold
+  uint8_t                   fc_full;        // Flow control receive FIFO section full threshold
+  uint8_t                   mdio_get;       // MDIO queue head index
+  uint8_t                   mdio_cnt;       // Number of queued MDIO transactions
+  uint8_t                   phy_addr;       // Address of PHY in register cache
+  uint32_t                  phy_valid;      // PHY register cache valid flags
+  uint8_t                   link_phy;       // Link monitor: PHY address
+  uint8_t                   link_step;      // Link monitor: index of PHY register being read
+  volatile uint8_t          link_busy;      // Link monitor: PHY register read in progress
+  volatile uint8_t          link_pend;      // Link monitor: interrupt received during read
+  volatile uint8_t          link_retry;     // Link monitor: read rejected by full MDIO queue
+  volatile uint8_t          link_apply;     // Link monitor: negotiated configuration not yet applied
+  uint8_t                   link_state;     // Link monitor: link state (ARM_ETH_LINK_STATE)
+  uint8_t                   link_speed;     // Link monitor: link speed (ARM_ETH_SPEED_...)
+  uint8_t                   link_duplex;    // Link monitor: duplex mode (ARM_ETH_DUPLEX_...)
 } EMAC_INFO;
 
 /* Global functions and variables exported by driver .c module */
 extern ARM_DRIVER_ETH_MAC Driver_ETH_MAC0;
 
+/**
+  \fn          int32_t EMAC_ReadFrames (EMAC_FRAME *frames, uint32_t num)
+  \brief       Read data of multiple received Ethernet frames.
+  \param[in,out] frames  Array of frame buffers (len: buffer size on input, number of data bytes read on output)
+  \param[in]   num     Number of frame buffers in array
+  \return      number of frames read or execution status when negative
+*/
+extern int32_t EMAC_ReadFrames (EMAC_FRAME *frames, uint32_t num);
+
+/**
+  \fn          int32_t EMAC_PollRx (EMAC_FRAME *frames, uint32_t budget)
+  \brief       Read received Ethernet frames in poll mode, re-enable receive interrupt when drained.
+  \param[in,out] frames  Array of frame buffers
+  \param[in]   budget  Maximum number of frames to read
+  \return      number of frames read (less than budget when receive ring is drained) or execution status
+*/
+extern int32_t EMAC_PollRx (EMAC_FRAME *frames, uint32_t budget);
+
+/**
+  \fn          int32_t EMAC_SetRxRule (uint32_t idx, const EMAC_RX_RULE *rule)
+  \brief       Set or clear receive classification rule.
+  \param[in]   idx   Rule index, lower index is matched first
+  \param[in]   rule  Pointer to rule or NULL to clear the rule
+  \return      execution status
+*/
+extern int32_t EMAC_SetRxRule (uint32_t idx, const EMAC_RX_RULE *rule);
+
+/**
+  \fn          int32_t EMAC_ReadClassFrame (uint32_t cls, uint8_t *frame, uint32_t len)
+  \brief       Read data of the next received Ethernet frame in given receive class.
+  \param[in]   cls    Receive class
+  \param[in]   frame  Pointer to frame buffer for data to read into
+  \param[in]   len    Frame buffer length in bytes
+  \return      number of data bytes read (0 = no frame) or execution status when negative
+*/
+extern int32_t EMAC_ReadClassFrame (uint32_t cls, uint8_t *frame, uint32_t len);
+
+/**
+  \fn          int32_t EMAC_LoanRxFrame (uint8_t **frame)
+  \brief       Get received Ethernet frame without copying (zero-copy receive).
+  \param[out]  frame  Pointer where the pointer to the frame data is written to
+  \return      number of data bytes in frame (0 = no frame) or execution status when negative
+*/
+extern int32_t EMAC_LoanRxFrame (uint8_t **frame);
+
+/**
+  \fn          int32_t EMAC_ReleaseRxFrame (uint8_t *frame)
+  \brief       Release receive buffer obtained with EMAC_LoanRxFrame.
+  \param[in]   frame  Pointer to frame data returned by EMAC_LoanRxFrame
+  \return      execution status
+*/
+extern int32_t EMAC_ReleaseRxFrame (uint8_t *frame);
+
+/**
+  \fn          int32_t EMAC_GetMulticastStats (uint32_t *hit, uint32_t num, uint32_t *false_pos)
+  \brief       Get exact multicast address filter counters.
+  \param[out]  hit        Pointer to array receiving number of frames received for each configured address
+  \param[in]   num        Number of elements in hit array
+  \param[out]  false_pos  Pointer to number of discarded hash filter false positive frames
+  \return      number of addresses in exact multicast address table or execution status
+*/
+extern int32_t EMAC_GetMulticastStats (uint32_t *hit, uint32_t num, uint32_t *false_pos);
+
+/**
+  \fn          int32_t EMAC_SetUnicastFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr)
+  \brief       Configure additional unicast addresses received besides the station address.
+  \param[in]   ptr_addr  Pointer to addresses
+  \param[in]   num_addr  Number of addresses to configure (0 = station address only)
+  \return      execution status
+*/
+extern int32_t EMAC_SetUnicastFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr);
+
+/**
+  \fn          int32_t EMAC_GetLatency (uint32_t type, uint32_t *hist, uint32_t num, uint32_t reset)
+  \brief       Get latency histogram (requires EMAC_LATENCY).
+  \param[in]   type   Histogram (EMAC_LATENCY_RX_READ, EMAC_LATENCY_TX_SEND or EMAC_LATENCY_TX_DONE)
+  \param[out]  hist   Pointer to array of bin counters (NULL = only reset)
+  \param[in]   num    Number of elements in array
+  \param[in]   reset  Clear histogram after reading (0 = no, 1 = yes)
+  \return      number of bins read or execution status when negative
+*/
+extern int32_t EMAC_GetLatency (uint32_t type, uint32_t *hist, uint32_t num, uint32_t reset);
+
+/**
+  \fn          int32_t EMAC_MDIO_Submit (EMAC_MDIO_XFER *xfer)
+  \brief       Queue MDIO transaction, completed from ENET interrupt (cached register read: before return).
+  \param[in]   xfer  Pointer to MDIO transaction
+  \return      execution status
+*/
+extern int32_t EMAC_MDIO_Submit (EMAC_MDIO_XFER *xfer);
+
+/**
+  \fn          int32_t EMAC_CaptureStart (uint32_t snaplen, uint32_t sample)
+  \brief       Start capture of received and transmitted frames (requires EMAC_CAPTURE_SIZE).
+  \param[in]   snaplen  Maximum number of bytes captured per frame
+  \param[in]   sample   Capture every n-th frame (1 = all frames)
+  \return      execution status
+*/
+extern int32_t EMAC_CaptureStart (uint32_t snaplen, uint32_t sample);
+
+/**
+  \fn          int32_t EMAC_CaptureStop (void)
+  \brief       Stop frame capture, captured records remain in the ring buffer.
+  \return      execution status
+*/
+extern int32_t EMAC_CaptureStop (void);
+
+/**
+  \fn          uint32_t EMAC_CaptureHeader (uint8_t *buf)
+  \brief       Get pcap file header.
+  \param[out]  buf   Pointer to buffer of at least 24 bytes
+  \return      number of bytes written
+*/
+extern uint32_t EMAC_CaptureHeader (uint8_t *buf);
+
+/**
+  \fn          int32_t EMAC_CaptureRead (uint8_t *buf, uint32_t len)
+  \brief       Read captured pcap records from the capture ring buffer.
+  \param[out]  buf   Pointer to buffer for pcap records
+  \param[in]   len   Buffer size in bytes
+  \return      number of bytes read (complete records only) or execution status when negative
+*/
+extern int32_t EMAC_CaptureRead (uint8_t *buf, uint32_t len);
+
+/**
+  \fn          void EMAC_CaptureTime (uint32_t *sec, uint32_t *usec)
+  \brief       Get timestamp of captured frame (weak, can be overridden by the application).
+  \param[out]  sec   Pointer to seconds
+  \param[out]  usec  Pointer to microseconds
+*/
+extern void EMAC_CaptureTime (uint32_t *sec, uint32_t *usec);
+
+/**
+  \fn          int32_t EMAC_LinkMonitor (uint32_t phy_addr, uint32_t enable)
+  \brief       Enable or disable interrupt driven PHY link monitor (requires EMAC_PHY_INT_PIN).
+  \param[in]   phy_addr  5-bit PHY address
+  \param[in]   enable    0 = disable, 1 = enable link monitor
+  \return      execution status
+*/
+extern int32_t EMAC_LinkMonitor (uint32_t phy_addr, uint32_t enable);
+
+/**
+  \fn          ARM_ETH_LINK_STATE EMAC_GetLinkState (ARM_ETH_LINK_INFO *info)
+  \brief       Get link state tracked by PHY link monitor and apply negotiated link configuration (thread context).
+  \param[out]  info  Pointer to link information (speed and duplex mode), can be NULL
+  \return      link state
+*/
+extern ARM_ETH_LINK_STATE EMAC_GetLinkState (ARM_ETH_LINK_INFO *info);
+
+/**
+  \fn          int32_t EMAC_GetStatistics (EMAC_STATS *stats)
+  \brief       Get ENET MIB and driver statistics.
+  \param[out]  stats  Pointer to statistics structure
+  \return      execution status
+*/
+extern int32_t EMAC_GetStatistics (EMAC_STATS *stats);
+
+/**
+  \fn          int32_t EMAC_GetStatisticsDelta (EMAC_STATS *snapshot, EMAC_STATS *delta)
+  \brief       Get statistics increments since previous snapshot and update snapshot.
+  \param[in,out] snapshot  Pointer to snapshot structure
+  \param[out]  delta     Pointer to structure receiving counter increments
+  \return      execution status
+*/
+extern int32_t EMAC_GetStatisticsDelta (EMAC_STATS *snapshot, EMAC_STATS *delta);
+
 #endif /* EMAC_IMXRT105x_H__ */
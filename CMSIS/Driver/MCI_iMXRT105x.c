@@ -17,8 +17,8 @@
  * limitations under the License.
  *
  *
- * $Date:        4. October 2023
- * $Revision:    V1.5
+ * $Date:        16. October 2026
+ * $Revision:    V1.6
  *
  * Driver:       Driver_MCI0
  * Configured:   pin/clock configuration via MCUXpresso Config Tools
@@ -34,6 +34,8 @@
  * -------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.6
+ *    Sized ADMA descriptor table to the transfer, added configurable maximum transfer size (MCI_ADMA_XFER_MAX)
  *  Version 1.5
  *    Added volatile qualifier to volatile variables
  *  Version 1.4
@@ -93,6 +95,23 @@ the values that are shown in <em>italics</em>):
 -# Go to <b>Views - Details</b> and configure USDHC1_CLK_ROOT to frequency below or equal to <em>198MHz</em>.
    USDHC1_CLK_ROOT source can be selected from PLL2_PFD2_CLK or PLL2_PFD0_CLK which must be configured accordingly.
 -# Click on <b>Update Project</b> button to update source files
+
+<b>CMSIS-Driver for MCI Interface Configuration</b>
+
+The following defines can be added to the project (for example to the compiler preprocessor settings) in order to
+change the default driver configuration:
+
+| Define                   | Default | Description                                                              |
+|:-------------------------|:--------|:-------------------------------------------------------------------------|
+| MCI_ADMA_XFER_MAX        | 4 MB    | Maximum bytes per data command, sizes the default descriptor table       |
+| MCI_ADMA_DESCR_CNT       | -       | ADMA descriptor table size in words (default: derived from MCI_ADMA_XFER_MAX) |
+
+Data is transferred by ADMA2 using a descriptor table in noncacheable memory. Each descriptor occupies two words
+and moves up to 65532 bytes, so the default table of 130 words (520 bytes per instance) allows a multi-block
+command to move 4 MB. \b SetupTransfer builds the table only for the number of descriptors required by the block
+count and size, and returns \b ARM_DRIVER_ERROR_PARAMETER when the transfer does not fit into the table. The
+limit is derived from the table size alone: when \b MCI_ADMA_DESCR_CNT is defined, \b MCI_ADMA_XFER_MAX is not
+used and a transfer may move up to 65532 bytes per descriptor.
 */
 
 /*! \cond */
@@ -106,14 +125,24 @@ the values that are shown in <em>italics</em>):
   #define DRIVER_MCI1             0
 #endif
 
+#ifndef MCI_ADMA_XFER_MAX
+  /* Define maximum number of bytes transferred by one data command */
+  #define MCI_ADMA_XFER_MAX  (4U * 1024U * 1024U)
+#endif
+
 #ifndef MCI_ADMA_DESCR_CNT
-  /* Define number of ADMA descriptors */
-  #define MCI_ADMA_DESCR_CNT 8U
+  /* Define ADMA descriptor table size in words (two words per descriptor) */
+  #define MCI_ADMA_DESCR_CNT (2U * ((MCI_ADMA_XFER_MAX + USDHC_ADMA2_DESCRIPTOR_MAX_LENGTH_PER_ENTRY - 1U) / \
+                                    USDHC_ADMA2_DESCRIPTOR_MAX_LENGTH_PER_ENTRY))
 #endif
 
 #include "MCI_iMXRT105x.h"
 
-#define ARM_MCI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,5)  /* driver version */
+#if ((MCI_ADMA_DESCR_CNT < 2U) || ((MCI_ADMA_DESCR_CNT % 2U) != 0U))
+  #error "MCI_ADMA_DESCR_CNT must be a non-zero multiple of 2"
+#endif
+
+#define ARM_MCI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,6)  /* driver version */
 
 /* Driver Capabilities */
 #if (DRIVER_MCI0)
@@ -347,6 +376,9 @@ static int32_t Initialize (ARM_MCI_SignalEvent_t cb_event, MCI_RESOURCES *mci) {
   /* Register instance resources (callback argument) */
   mci->ctrl->h.userData = (void *)(uint32_t)mci;
 
+  /* DMA configuration, table size is set for each transfer */
+  mci->ctrl->dma = mci->dma;
+
   mci->ctrl->flags = MCI_INIT;
 
   return ARM_DRIVER_OK;
@@ -497,7 +529,6 @@ static int32_t ReadWP (MCI_RESOURCES *mci) {
   \return        \ref execution_status
 */
 static int32_t SendCommand (uint32_t cmd, uint32_t arg, uint32_t flags, uint32_t *response, MCI_RESOURCES *mci) {
-  usdhc_adma_config_t *dma_cfg;
 
   if (((flags & MCI_RESPONSE_EXPECTED_Msk) != 0U) && (response == NULL)) {
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -575,10 +606,8 @@ static int32_t SendCommand (uint32_t cmd, uint32_t arg, uint32_t flags, uint32_t
     mci->ctrl->xfer.data = NULL;
     mci->ctrl->cmd.flags = 0U;
   }
-  
-  dma_cfg = (usdhc_adma_config_t *)((uint32_t)&mci->dma);
 
-  if (kStatus_Success != USDHC_TransferNonBlocking (mci->reg, &mci->ctrl->h, dma_cfg, &mci->ctrl->xfer)) {
+  if (kStatus_Success != USDHC_TransferNonBlocking (mci->reg, &mci->ctrl->h, &mci->ctrl->dma, &mci->ctrl->xfer)) {
     return ARM_DRIVER_ERROR;
   }
 
@@ -600,6 +629,8 @@ static int32_t SendCommand (uint32_t cmd, uint32_t arg, uint32_t flags, uint32_t
 */
 static int32_t SetupTransfer (uint8_t *data, uint32_t block_count, uint32_t block_size, uint32_t mode, MCI_RESOURCES *mci) {
   uint32_t data_addr = (uint32_t)data; /* DMA might require 4-byte aligned address */
+  uint64_t size;
+  uint32_t words;
 
   if ((data == NULL) || (block_count == 0U) || (block_size == 0U)) { return ARM_DRIVER_ERROR_PARAMETER; }
 
@@ -614,6 +645,15 @@ static int32_t SetupTransfer (uint8_t *data, uint32_t block_count, uint32_t bloc
     return ARM_DRIVER_ERROR;
   }
 
+  /* Size ADMA descriptor table to the transfer */
+  size = (uint64_t)block_count * block_size;
+  if (size > ((uint64_t)(mci->dma.admaTableWords / 2U) * USDHC_ADMA2_DESCRIPTOR_MAX_LENGTH_PER_ENTRY)) {
+    /* Transfer does not fit into descriptor table */
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  words = 2U * (uint32_t)((size + USDHC_ADMA2_DESCRIPTOR_MAX_LENGTH_PER_ENTRY - 1U) / USDHC_ADMA2_DESCRIPTOR_MAX_LENGTH_PER_ENTRY);
+  mci->ctrl->dma.admaTableWords = words;
+
   mci->ctrl->flags |= MCI_DATA;
 
   mci->ctrl->data.enableAutoCommand12 = false;
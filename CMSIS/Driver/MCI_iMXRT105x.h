@@ -17,8 +17,8 @@
  * limitations under the License.
  *
  *
- * $Date:        4. October 2023
- * $Revision:    V1.3
+ * $Date:        16. October 2026
+ * $Revision:    V1.4
  *
  * Project:      MCI Driver Definitions for NXP iMX RT
  * -------------------------------------------------------------------------- */
@@ -168,6 +168,7 @@ typedef struct MCI_Ctrl {
   usdhc_handle_t            h;          /* SDHC driver handle                 */
   usdhc_data_t              data;
   usdhc_command_t           cmd;
+  usdhc_adma_config_t       dma;        /* DMA config of current transfer     */
   uint8_t volatile          flags;      /* Driver state flags                 */
   uint8_t                   rsvd[3];    /* Reserved */
 } MCI_CTRL;
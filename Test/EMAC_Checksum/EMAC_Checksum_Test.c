@@ -0,0 +1,314 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host test for EMAC Internet checksum functions
+ * -------------------------------------------------------------------------- */
+
+/*
+  Checks EMAC_Checksum_iMXRT105x.c against a byte-wise RFC 1071 reference on
+  a little-endian build host. Build and run from the repository root:
+
+    gcc -O2 -Wall -Wextra -ITest/EMAC_Checksum -ICMSIS/Driver
+        Test/EMAC_Checksum/EMAC_Checksum_Test.c CMSIS/Driver/EMAC_Checksum_iMXRT105x.c
+        -o emac_checksum_test
+    ./emac_checksum_test          (tests only)
+    ./emac_checksum_test bench    (tests and host throughput comparison)
+
+  The program returns 0 when all tests pass. Host throughput only compares the
+  word-wise and the byte-wise algorithm, it does not predict Cortex-M7 timing.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "EMAC_Checksum_iMXRT105x.h"
+
+#define BUF_SIZE        2048U
+#define BENCH_LEN       1500U
+#define BENCH_CNT       200000U
+
+static uint8_t  Buf[BUF_SIZE + 8U];
+static uint32_t Seed = 1U;
+static uint32_t Fails;
+
+/* Pseudo random numbers (xorshift32) */
+static uint32_t Rand (void) {
+  Seed ^= Seed << 13;
+  Seed ^= Seed >> 17;
+  Seed ^= Seed << 5;
+  return (Seed);
+}
+
+static void Fill (uint8_t *data, uint32_t len) {
+  uint32_t i;
+
+  for (i = 0U; i < len; i++) {
+    data[i] = (uint8_t)Rand ();
+  }
+}
+
+/* Reference: one's complement sum of big-endian 16-bit words, odd byte padded with zero (RFC 1071) */
+static uint32_t RefAdd (const uint8_t *data, uint32_t len, uint32_t sum) {
+  uint32_t i;
+
+  for (i = 0U; (i + 1U) < len; i += 2U) {
+    sum += ((uint32_t)data[i] << 8) | data[i + 1U];
+  }
+  if ((len & 1U) != 0U) {
+    sum += (uint32_t)data[len - 1U] << 8;
+  }
+  while ((sum >> 16) != 0U) {
+    sum = (sum & 0xFFFFU) + (sum >> 16);
+  }
+  return (sum);
+}
+
+static uint16_t RefChecksum (const uint8_t *data, uint32_t len) {
+  return ((uint16_t)~RefAdd (data, len, 0U));
+}
+
+static void Check (int cond, const char *name, uint32_t a, uint32_t b) {
+  if (!cond) {
+    if (Fails < 20U) {
+      printf ("FAIL %s (%u, %u)\n", name, (unsigned)a, (unsigned)b);
+    }
+    Fails++;
+  }
+}
+
+/* All lengths up to 300 bytes (odd and even) at all start offsets 0..7 */
+static void TestBlock (void) {
+  uint32_t len, ofs;
+
+  for (ofs = 0U; ofs < 8U; ofs++) {
+    for (len = 0U; len <= 300U; len++) {
+      Fill (&Buf[ofs], len);
+      Check (EMAC_Checksum (&Buf[ofs], len) == RefChecksum (&Buf[ofs], len), "EMAC_Checksum", ofs, len);
+    }
+  }
+  /* Long block with carries: all bytes 0xFF */
+  memset (Buf, 0xFF, BUF_SIZE);
+  Check (EMAC_Checksum (&Buf[1], BUF_SIZE - 1U) == RefChecksum (&Buf[1], BUF_SIZE - 1U), "EMAC_Checksum 0xFF", 1U, BUF_SIZE - 1U);
+}
+
+/* Partial sums chained at even split points */
+static void TestChain (void) {
+  uint32_t len, split, ofs, sum;
+
+  for (len = 0U; len <= 200U; len += 7U) {
+    ofs = Rand () & 7U;
+    Fill (&Buf[ofs], len);
+    for (split = 0U; split <= len; split += 2U) {
+      sum = EMAC_ChecksumAdd (&Buf[ofs], split, 0U);
+      sum = EMAC_ChecksumAdd (&Buf[ofs + split], len - split, sum);
+      Check (EMAC_ChecksumFinal (sum) == RefChecksum (&Buf[ofs], len), "EMAC_ChecksumAdd chain", len, split);
+    }
+  }
+}
+
+/* Pseudo header (length summed as __REV(len)) against explicit RFC 768/RFC 8200 pseudo header bytes */
+static void TestPseudo (void) {
+  uint8_t  ph[40];
+  uint8_t  src[16], dst[16];
+  uint32_t i, n, len, sum, ref;
+  uint8_t  proto;
+
+  for (i = 0U; i < 2000U; i++) {
+    Fill (src, 16U);
+    Fill (dst, 16U);
+    proto = (uint8_t)Rand ();
+    n     = (Rand () % 64U) + 1U;
+    Fill (Buf, n);
+
+    /* IPv4: src, dst, zero, protocol, 16-bit length */
+    len = Rand () & 0xFFFFU;
+    memcpy (&ph[0], src, 4U);
+    memcpy (&ph[4], dst, 4U);
+    ph[8]  = 0U;
+    ph[9]  = proto;
+    ph[10] = (uint8_t)(len >> 8);
+    ph[11] = (uint8_t)len;
+    ref = RefAdd (ph, 12U, 0U);
+    ref = (uint16_t)~RefAdd (Buf, n, ref);
+    sum = EMAC_ChecksumPseudo (src, dst, 4U, proto, len);
+    sum = EMAC_ChecksumAdd (Buf, n, sum);
+    Check (EMAC_ChecksumFinal (sum) == ref, "EMAC_ChecksumPseudo IPv4", len, n);
+
+    /* IPv6: src, dst, 32-bit length, 3 zero bytes, next header */
+    len = Rand () & 0x1FFFFU;
+    memcpy (&ph[0],  src, 16U);
+    memcpy (&ph[16], dst, 16U);
+    ph[32] = (uint8_t)(len >> 24);
+    ph[33] = (uint8_t)(len >> 16);
+    ph[34] = (uint8_t)(len >> 8);
+    ph[35] = (uint8_t)len;
+    ph[36] = 0U;
+    ph[37] = 0U;
+    ph[38] = 0U;
+    ph[39] = proto;
+    ref = RefAdd (ph, 40U, 0U);
+    ref = (uint16_t)~RefAdd (Buf, n, ref);
+    sum = EMAC_ChecksumPseudo (src, dst, 16U, proto, len);
+    sum = EMAC_ChecksumAdd (Buf, n, sum);
+    Check (EMAC_ChecksumFinal (sum) == ref, "EMAC_ChecksumPseudo IPv6", len, n);
+  }
+}
+
+/* Incremental update (RFC 1624) against full recalculation */
+static void TestUpdate (void) {
+  uint8_t  hdr[20];
+  uint32_t i, pos, old32, new32;
+  uint16_t csum, old16, new16;
+
+  /* RFC 1624 section 4 example: result must be 0x0000, not 0xFFFF */
+  Check (EMAC_ChecksumUpdate16 (0xDD2FU, 0x5555U, 0x3285U) == 0x0000U, "RFC 1624 example", 0xDD2FU, 0x0000U);
+
+  for (i = 0U; i < 20000U; i++) {
+    Fill (hdr, 20U);
+    if ((i & 0xFFU) == 0U) {
+      /* Sum of other words is zero, checksum field covers the corner cases */
+      memset (hdr, 0, 20U);
+    }
+    hdr[10] = 0U;
+    hdr[11] = 0U;
+    csum = RefChecksum (hdr, 20U);
+    hdr[10] = (uint8_t)(csum >> 8);
+    hdr[11] = (uint8_t)csum;
+
+    /* 16-bit field (e.g. TTL/protocol or identification) */
+    pos   = (Rand () % 5U) * 2U;
+    old16 = (uint16_t)(((uint32_t)hdr[pos] << 8) | hdr[pos + 1U]);
+    new16 = ((i & 0x3FU) == 1U) ? 0U : (uint16_t)Rand ();
+    hdr[pos]      = (uint8_t)(new16 >> 8);
+    hdr[pos + 1U] = (uint8_t)new16;
+    csum = EMAC_ChecksumUpdate16 (csum, old16, new16);
+    hdr[10] = (uint8_t)(csum >> 8);
+    hdr[11] = (uint8_t)csum;
+    Check (RefAdd (hdr, 20U, 0U) == 0xFFFFU, "EMAC_ChecksumUpdate16", old16, new16);
+
+    /* 32-bit field (source address) */
+    old32 = ((uint32_t)hdr[12] << 24) | ((uint32_t)hdr[13] << 16) | ((uint32_t)hdr[14] << 8) | hdr[15];
+    new32 = Rand ();
+    hdr[12] = (uint8_t)(new32 >> 24);
+    hdr[13] = (uint8_t)(new32 >> 16);
+    hdr[14] = (uint8_t)(new32 >> 8);
+    hdr[15] = (uint8_t)new32;
+    csum = EMAC_ChecksumUpdate32 (csum, old32, new32);
+    hdr[10] = (uint8_t)(csum >> 8);
+    hdr[11] = (uint8_t)csum;
+    Check (RefAdd (hdr, 20U, 0U) == 0xFFFFU, "EMAC_ChecksumUpdate32", old32, new32);
+  }
+}
+
+/* Receive frame verification of an IPv4/UDP frame with odd payload length */
+static void TestVerifyFrame (void) {
+  uint8_t  *frame = &Buf[2];
+  uint8_t  *ip    = &frame[14];
+  uint8_t  *udp   = &ip[20];
+  uint32_t plen   = 8U + 37U;
+  uint32_t sum;
+  uint16_t csum;
+
+  memset (frame, 0, 14U + 20U + plen);
+  frame[12] = 0x08U;
+  ip[0]  = 0x45U;
+  ip[2]  = (uint8_t)((20U + plen) >> 8);
+  ip[3]  = (uint8_t)(20U + plen);
+  ip[8]  = 64U;
+  ip[9]  = 17U;
+  Fill (&ip[12], 8U);
+  csum   = EMAC_Checksum (ip, 20U);
+  ip[10] = (uint8_t)(csum >> 8);
+  ip[11] = (uint8_t)csum;
+
+  Fill (udp, plen);
+  udp[4] = (uint8_t)(plen >> 8);
+  udp[5] = (uint8_t)plen;
+  udp[6] = 0U;
+  udp[7] = 0U;
+  sum  = EMAC_ChecksumPseudo (&ip[12], &ip[16], 4U, 17U, plen);
+  csum = EMAC_ChecksumFinal (EMAC_ChecksumAdd (udp, plen, sum));
+  if (csum == 0U) {
+    csum = 0xFFFFU;
+  }
+  udp[6] = (uint8_t)(csum >> 8);
+  udp[7] = (uint8_t)csum;
+
+  Check (EMAC_ChecksumVerifyFrame (frame, 14U + 20U + plen) == 1U, "EMAC_ChecksumVerifyFrame valid", 0U, 0U);
+  udp[8] ^= 0x01U;
+  Check (EMAC_ChecksumVerifyFrame (frame, 14U + 20U + plen) == 0U, "EMAC_ChecksumVerifyFrame payload error", 0U, 0U);
+  udp[8] ^= 0x01U;
+  ip[8]  ^= 0x01U;
+  Check (EMAC_ChecksumVerifyFrame (frame, 14U + 20U + plen) == 0U, "EMAC_ChecksumVerifyFrame header error", 0U, 0U);
+}
+
+/* Host throughput of word-wise and byte-wise checksum for full size frames */
+static void Bench (void) {
+  volatile uint16_t res;
+  uint32_t ofs, i;
+  double   t[3];
+  clock_t  start;
+
+  Fill (Buf, BENCH_LEN + 2U);
+  for (ofs = 0U; ofs < 3U; ofs++) {
+    start = clock ();
+    for (i = 0U; i < BENCH_CNT; i++) {
+      /* Changed data, calls cannot be hoisted out of the loop */
+      Buf[4] = (uint8_t)i;
+      if (ofs == 2U) {
+        res = RefChecksum (Buf, BENCH_LEN);
+      } else {
+        res = EMAC_Checksum (&Buf[ofs * 2U], BENCH_LEN);
+      }
+    }
+    t[ofs] = (double)(clock () - start) / CLOCKS_PER_SEC;
+  }
+  (void)res;
+
+  printf ("%u x %u bytes: aligned %.1f MB/s, unaligned %.1f MB/s, reference %.1f MB/s\n",
+          (unsigned)BENCH_CNT, (unsigned)BENCH_LEN,
+          (BENCH_CNT * (double)BENCH_LEN) / (t[0] * 1e6),
+          (BENCH_CNT * (double)BENCH_LEN) / (t[1] * 1e6),
+          (BENCH_CNT * (double)BENCH_LEN) / (t[2] * 1e6));
+}
+
+int main (int argc, char *argv[]) {
+
+  TestBlock ();
+  TestChain ();
+  TestPseudo ();
+  TestUpdate ();
+  TestVerifyFrame ();
+
+  if (Fails != 0U) {
+    printf ("%u checks failed\n", (unsigned)Fails);
+    return (1);
+  }
+  printf ("All checks passed\n");
+
+  if ((argc > 1) && (strcmp (argv[1], "bench") == 0)) {
+    Bench ();
+  }
+  return (0);
+}
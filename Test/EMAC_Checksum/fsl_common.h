@@ -0,0 +1,52 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host replacement of fsl_common.h for EMAC checksum test
+ * -------------------------------------------------------------------------- */
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+/*
+  Provides the CMSIS intrinsics used by EMAC_Checksum_iMXRT105x.c for a
+  little-endian build host (GCC or Clang).
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+static inline uint32_t __REV (uint32_t value) {
+  return (__builtin_bswap32 (value));
+}
+
+static inline uint32_t __REV16 (uint32_t value) {
+  return (((value & 0x00FF00FFU) << 8) | ((value >> 8) & 0x00FF00FFU));
+}
+
+static inline uint32_t __UNALIGNED_UINT32_READ (const void *addr) {
+  uint32_t value;
+
+  memcpy (&value, addr, sizeof(value));
+  return (value);
+}
+
+#endif /* FSL_COMMON_H_ */
@@ -0,0 +1,59 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host replacement of CMSIS Driver_ETH.h for EMAC host model
+ * -------------------------------------------------------------------------- */
+
+#ifndef DRIVER_ETH_H_
+#define DRIVER_ETH_H_
+
+/* Subset of CMSIS-Driver Driver_ETH.h used by EMAC_iMXRT105x.c */
+
+#include "Driver_Common.h"
+
+#define ARM_ETH_INTERFACE_MII           (0U)
+#define ARM_ETH_INTERFACE_RMII          (1U)
+#define ARM_ETH_INTERFACE_SMII          (2U)
+
+#define ARM_ETH_SPEED_10M               (0U)
+#define ARM_ETH_SPEED_100M              (1U)
+#define ARM_ETH_SPEED_1G                (2U)
+
+#define ARM_ETH_DUPLEX_HALF             (0U)
+#define ARM_ETH_DUPLEX_FULL             (1U)
+
+typedef enum _ARM_ETH_LINK_STATE {
+  ARM_ETH_LINK_DOWN,
+  ARM_ETH_LINK_UP
+} ARM_ETH_LINK_STATE;
+
+typedef struct _ARM_ETH_LINK_INFO {
+  uint32_t speed    : 2;
+  uint32_t duplex   : 1;
+  uint32_t reserved : 29;
+} ARM_ETH_LINK_INFO;
+
+typedef struct _ARM_ETH_MAC_ADDR {
+  uint8_t b[6];
+} ARM_ETH_MAC_ADDR;
+
+#endif /* DRIVER_ETH_H_ */
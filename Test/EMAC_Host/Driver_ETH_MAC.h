@@ -0,0 +1,126 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host replacement of CMSIS Driver_ETH_MAC.h for EMAC host model
+ * -------------------------------------------------------------------------- */
+
+#ifndef DRIVER_ETH_MAC_H_
+#define DRIVER_ETH_MAC_H_
+
+/* Subset of CMSIS-Driver Driver_ETH_MAC.h used by EMAC_iMXRT105x.c */
+
+#include "Driver_ETH.h"
+
+#define ARM_ETH_MAC_API_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(2,2)
+
+#define ARM_ETH_MAC_CONFIGURE           (0x01UL)
+#define ARM_ETH_MAC_CONTROL_TX          (0x02UL)
+#define ARM_ETH_MAC_CONTROL_RX          (0x03UL)
+#define ARM_ETH_MAC_FLUSH               (0x04UL)
+#define ARM_ETH_MAC_SLEEP               (0x05UL)
+#define ARM_ETH_MAC_VLAN_FILTER         (0x06UL)
+
+#define ARM_ETH_MAC_SPEED_Pos            0
+#define ARM_ETH_MAC_SPEED_Msk           (3UL                 << ARM_ETH_MAC_SPEED_Pos)
+#define ARM_ETH_MAC_SPEED_10M           (ARM_ETH_SPEED_10M   << ARM_ETH_MAC_SPEED_Pos)
+#define ARM_ETH_MAC_SPEED_100M          (ARM_ETH_SPEED_100M  << ARM_ETH_MAC_SPEED_Pos)
+#define ARM_ETH_MAC_SPEED_1G            (ARM_ETH_SPEED_1G    << ARM_ETH_MAC_SPEED_Pos)
+#define ARM_ETH_MAC_DUPLEX_Pos           2
+#define ARM_ETH_MAC_DUPLEX_Msk          (1UL                 << ARM_ETH_MAC_DUPLEX_Pos)
+#define ARM_ETH_MAC_DUPLEX_HALF         (ARM_ETH_DUPLEX_HALF << ARM_ETH_MAC_DUPLEX_Pos)
+#define ARM_ETH_MAC_DUPLEX_FULL         (ARM_ETH_DUPLEX_FULL << ARM_ETH_MAC_DUPLEX_Pos)
+#define ARM_ETH_MAC_LOOPBACK            (1UL << 4)
+#define ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX (1UL << 5)
+#define ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX (1UL << 6)
+#define ARM_ETH_MAC_ADDRESS_BROADCAST   (1UL << 7)
+#define ARM_ETH_MAC_ADDRESS_MULTICAST   (1UL << 8)
+#define ARM_ETH_MAC_ADDRESS_ALL         (1UL << 9)
+
+#define ARM_ETH_MAC_FLUSH_RX            (1UL << 0)
+#define ARM_ETH_MAC_FLUSH_TX            (1UL << 1)
+
+#define ARM_ETH_MAC_VLAN_FILTER_ID_ONLY (1UL << 16)
+
+#define ARM_ETH_MAC_TX_FRAME_FRAGMENT   (1UL << 0)
+#define ARM_ETH_MAC_TX_FRAME_EVENT      (1UL << 1)
+#define ARM_ETH_MAC_TX_FRAME_TIMESTAMP  (1UL << 2)
+
+#define ARM_ETH_MAC_TIMER_GET_TIME      (0x01UL)
+#define ARM_ETH_MAC_TIMER_SET_TIME      (0x02UL)
+#define ARM_ETH_MAC_TIMER_INC_TIME      (0x03UL)
+#define ARM_ETH_MAC_TIMER_DEC_TIME      (0x04UL)
+#define ARM_ETH_MAC_TIMER_SET_ALARM     (0x05UL)
+#define ARM_ETH_MAC_TIMER_ADJUST_CLOCK  (0x06UL)
+
+typedef struct _ARM_ETH_MAC_TIME {
+  uint32_t ns;
+  uint32_t sec;
+} ARM_ETH_MAC_TIME;
+
+#define ARM_ETH_MAC_EVENT_RX_FRAME      (1UL << 0)
+#define ARM_ETH_MAC_EVENT_TX_FRAME      (1UL << 1)
+#define ARM_ETH_MAC_EVENT_WAKEUP        (1UL << 2)
+#define ARM_ETH_MAC_EVENT_TIMER_ALARM   (1UL << 3)
+
+typedef void (*ARM_ETH_MAC_SignalEvent_t) (uint32_t event);
+
+typedef struct _ARM_ETH_MAC_CAPABILITIES {
+  uint32_t checksum_offload_rx_ip4  : 1;
+  uint32_t checksum_offload_rx_ip6  : 1;
+  uint32_t checksum_offload_rx_udp  : 1;
+  uint32_t checksum_offload_rx_tcp  : 1;
+  uint32_t checksum_offload_rx_icmp : 1;
+  uint32_t checksum_offload_tx_ip4  : 1;
+  uint32_t checksum_offload_tx_ip6  : 1;
+  uint32_t checksum_offload_tx_udp  : 1;
+  uint32_t checksum_offload_tx_tcp  : 1;
+  uint32_t checksum_offload_tx_icmp : 1;
+  uint32_t media_interface          : 2;
+  uint32_t mac_address              : 1;
+  uint32_t event_rx_frame           : 1;
+  uint32_t event_tx_frame           : 1;
+  uint32_t event_wakeup             : 1;
+  uint32_t precision_timer          : 1;
+  uint32_t reserved                 : 15;
+} ARM_ETH_MAC_CAPABILITIES;
+
+typedef struct _ARM_DRIVER_ETH_MAC {
+  ARM_DRIVER_VERSION       (*GetVersion)      (void);
+  ARM_ETH_MAC_CAPABILITIES (*GetCapabilities) (void);
+  int32_t                  (*Initialize)      (ARM_ETH_MAC_SignalEvent_t cb_event);
+  int32_t                  (*Uninitialize)    (void);
+  int32_t                  (*PowerControl)    (ARM_POWER_STATE state);
+  int32_t                  (*GetMacAddress)   (      ARM_ETH_MAC_ADDR *ptr_addr);
+  int32_t                  (*SetMacAddress)   (const ARM_ETH_MAC_ADDR *ptr_addr);
+  int32_t                  (*SetAddressFilter)(const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr);
+  int32_t                  (*SendFrame)       (const uint8_t *frame, uint32_t len, uint32_t flags);
+  int32_t                  (*ReadFrame)       (      uint8_t *frame, uint32_t len);
+  uint32_t                 (*GetRxFrameSize)  (void);
+  int32_t                  (*GetRxFrameTime)  (ARM_ETH_MAC_TIME *time);
+  int32_t                  (*GetTxFrameTime)  (ARM_ETH_MAC_TIME *time);
+  int32_t                  (*ControlTimer)    (uint32_t control, ARM_ETH_MAC_TIME *time);
+  int32_t                  (*Control)         (uint32_t control, uint32_t arg);
+  int32_t                  (*PHY_Read)        (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data);
+  int32_t                  (*PHY_Write)       (uint8_t phy_addr, uint8_t reg_addr, uint16_t  data);
+} const ARM_DRIVER_ETH_MAC;
+
+#endif /* DRIVER_ETH_MAC_H_ */
@@ -0,0 +1,180 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host receive benchmark for EMAC_iMXRT105x.c on the ENET model
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in real time (see ENET_Model.h). The
+  wire thread injects frames at a fixed rate, the ENET interrupt runs on the
+  interrupt thread and the application thread reads frames with ReadFrame when
+  the receive event flag is set. Build and run from the repository root:
+
+    gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+        -ITest/EMAC_Host -ICMSIS/Driver Test/EMAC_Host/EMAC_Bench.c Test/EMAC_Host/Host_Core.c
+        Test/EMAC_Host/ENET_Model.c CMSIS/Driver/EMAC_iMXRT105x.c -o emac_bench
+    ./emac_bench [rate] [size] [msec]
+
+  rate is in frames/s (default 20000), size is the frame length without FCS
+  (60..1514, 0 = mixed sizes, default 0), msec is the run time (default 1000).
+  Reported are frames read per second, frames dropped for lack of an empty
+  receive descriptor and driver cycles per frame: host CPU time of the driver
+  calls, of the ENET interrupt handler and of the driver event thread
+  (EMAC_EVENT_THREAD) scaled to SystemCoreClock. Cycle
+  counts compare driver variants on the same host, they do not predict
+  Cortex-M7 timing. The program returns 0 when all frames read are intact.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "cmsis_os2.h"
+#include "EMAC_iMXRT105x.h"
+
+#define FRAME_MIN       60U
+#define FRAME_MAX       1514U
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static osThreadId_t        App;
+static uint32_t            Size;
+static uint8_t             Buf[FRAME_MAX + 16U];
+
+/* Frame length of frame seq */
+static uint32_t FrameLen (uint32_t seq) {
+  static const uint16_t mix[8] = { 60U, 60U, 60U, 60U, 590U, 590U, 1514U, 1514U };
+
+  return ((Size != 0U) ? Size : mix[(seq * 5U) & 7U]);
+}
+
+/* Frame: destination, source, local experimental ethertype, sequence number, pattern */
+static uint32_t Generate (uint8_t *frame, uint32_t seq) {
+  uint32_t len = FrameLen (seq);
+  uint32_t i;
+
+  memcpy (&frame[0], MacAddr, 6U);
+  memcpy (&frame[6], "\x02\x00\x00\x00\x00\x02", 6U);
+  frame[12] = 0x88U;
+  frame[13] = 0xB5U;
+  memcpy (&frame[14], &seq, 4U);
+  for (i = 18U; i < len; i++) {
+    frame[i] = (uint8_t)(seq + i);
+  }
+  return (len);
+}
+
+static uint32_t Check (const uint8_t *frame, uint32_t len) {
+  uint32_t seq, i;
+
+  if (len < 18U) {
+    return (0U);
+  }
+  memcpy (&seq, &frame[14], 4U);
+  if (len != FrameLen (seq)) {
+    return (0U);
+  }
+  for (i = 18U; i < len; i++) {
+    if (frame[i] != (uint8_t)(seq + i)) {
+      return (0U);
+    }
+  }
+  return (1U);
+}
+
+static void MAC_Event (uint32_t event) {
+  if ((event & ARM_ETH_MAC_EVENT_RX_FRAME) != 0U) {
+    (void)osThreadFlagsSet (App, 1U);
+  }
+}
+
+int main (int argc, char *argv[]) {
+  uint32_t rate  = (argc > 1) ? (uint32_t)strtoul (argv[1], NULL, 0) : 20000U;
+  uint32_t msec  = (argc > 3) ? (uint32_t)strtoul (argv[3], NULL, 0) : 1000U;
+  uint64_t cycles, t0, end, t;
+  uint32_t len, frames, bad;
+  int32_t  rc;
+
+  Size = (argc > 2) ? (uint32_t)strtoul (argv[2], NULL, 0) : 0U;
+  if ((rate == 0U) || ((Size != 0U) && ((Size < FRAME_MIN) || (Size > FRAME_MAX)))) {
+    printf ("usage: emac_bench [rate] [size] [msec]\n");
+    return (2);
+  }
+
+  Host_Init (0U);
+  App = osThreadGetId ();
+
+  (void)Mac->Initialize (MAC_Event);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL |
+                                             ARM_ETH_MAC_ADDRESS_BROADCAST);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 1U);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  frames = 0U;
+  bad    = 0U;
+  cycles = 0U;
+  ENET_ModelWireStart (rate, Generate, 0U);
+  t   = Host_Time ();
+  end = t + ((uint64_t)msec * 1000000U);
+  while (Host_Time () < end) {
+    t0 = Host_Cycles ();
+    while ((len = Mac->GetRxFrameSize ()) != 0U) {
+      rc = Mac->ReadFrame (Buf, (len <= sizeof(Buf)) ? len : 0U);
+      if ((rc < 0) || (Check (Buf, (uint32_t)rc) == 0U)) {
+        bad++;
+      }
+      frames++;
+    }
+    cycles += Host_Cycles () - t0;
+    (void)osThreadFlagsWait (1U, osFlagsWaitAny, 10U);
+  }
+  ENET_ModelWireStop ();
+  t = Host_Time () - t;
+
+  cycles += Host_Stats.irq_cycles + Host_Stats.thread_cycles;
+  if (Size != 0U) {
+    printf ("rate %u frames/s, size %u, %u ms\n", (unsigned)rate, (unsigned)Size, (unsigned)msec);
+  } else {
+    printf ("rate %u frames/s, mixed sizes, %u ms\n", (unsigned)rate, (unsigned)msec);
+  }
+  printf ("  frames read      %10u  (%.0f frames/s)\n", (unsigned)frames, (frames * 1e9) / (double)t);
+  printf ("  frames dropped   %10llu  (%.2f %%)\n", (unsigned long long)ENET_ModelStats.rx_drop,
+          (ENET_ModelStats.rx_frames != 0U) ? ((ENET_ModelStats.rx_drop * 100.0) / ENET_ModelStats.rx_frames) : 0.0);
+  printf ("  interrupts       %10llu\n", (unsigned long long)Host_Stats.irq_cnt);
+  printf ("  cycles/frame     %10.0f  (interrupt %.0f)\n",
+          (frames != 0U) ? ((double)cycles / frames) : 0.0,
+          (frames != 0U) ? ((double)Host_Stats.irq_cycles / frames) : 0.0);
+  if (bad != 0U) {
+    printf ("  %u frames corrupted\n", (unsigned)bad);
+  }
+
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 0U);
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  return ((bad != 0U) ? 1 : 0);
+}
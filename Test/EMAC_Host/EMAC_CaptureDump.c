@@ -0,0 +1,243 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host frame capture drain into a pcap file
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in virtual time (see ENET_Model.h)
+  with frame capture enabled, receives and sends frames of varying length and
+  drains the capture rings like a low priority capture thread: the pcap file
+  header from EMAC_CaptureHeader is written once, the records returned by
+  EMAC_CaptureRead are appended to the file. Received frames are read
+  alternately with ReadFrame and EMAC_ReadFrames. Build and run from the
+  repository root:
+
+    gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+        -ITest/EMAC_Host -ICMSIS/Driver -DEMAC_CAPTURE_SIZE=16384 Test/EMAC_Host/EMAC_CaptureDump.c
+        Test/EMAC_Host/Host_Core.c Test/EMAC_Host/ENET_Model.c CMSIS/Driver/EMAC_iMXRT105x.c
+        -o emac_capture_dump
+    ./emac_capture_dump [file] [frames] [snaplen] [sample]
+
+  file is the pcap file (default emac_capture.pcap, can be opened with
+  Wireshark or tcpdump -r), frames the number of frames per direction
+  (default 2000), snaplen and sample the arguments of EMAC_CaptureStart
+  (default 1514 and 1). Capture timestamps are the virtual time
+  (EMAC_CaptureTime is overridden). The file is read back and checked: every
+  sampled frame appears once, in order within its direction, truncated to
+  the snap length and with intact data, and timestamps do not decrease. The
+  program returns 0 when all checks pass.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+#define FRAME_MIN       60U
+#define FRAME_MAX       1514U
+#define DIR_RX          0U
+#define DIR_TX          1U
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static uint8_t  Frame[1536];
+static uint8_t  Rec[8192];
+static uint32_t Fails;
+
+static void Check (int cond, const char *name, uint32_t a, uint32_t b) {
+  if (!cond) {
+    if (Fails < 20U) {
+      printf ("FAIL %s (%u, %u)\n", name, (unsigned)a, (unsigned)b);
+    }
+    Fails++;
+  }
+}
+
+/* Capture timestamp: virtual time */
+void EMAC_CaptureTime (uint32_t *sec, uint32_t *usec) {
+  uint64_t t = Host_Time ();
+
+  *sec  = (uint32_t)(t / 1000000000U);
+  *usec = (uint32_t)((t % 1000000000U) / 1000U);
+}
+
+/* Frame length of sequence number, same in both directions */
+static uint32_t Length (uint32_t seq) {
+  return (FRAME_MIN + ((seq * 37U) % (FRAME_MAX - FRAME_MIN + 1U)));
+}
+
+/* Frame with direction, sequence number and pattern */
+static uint32_t Generate (uint8_t *frame, uint32_t dir, uint32_t seq) {
+  uint32_t len = Length (seq);
+  uint32_t i;
+
+  memcpy (&frame[0], (dir == DIR_RX) ? MacAddr : (const uint8_t *)"\x02\x00\x00\x00\x00\x02", 6U);
+  memcpy (&frame[6], (dir == DIR_RX) ? (const uint8_t *)"\x02\x00\x00\x00\x00\x02" : MacAddr, 6U);
+  frame[12] = 0x88U;
+  frame[13] = 0xB5U;
+  memcpy (&frame[14], &seq, 4U);
+  frame[18] = (uint8_t)dir;
+  for (i = 19U; i < len; i++) {
+    frame[i] = (uint8_t)(seq + i + dir);
+  }
+  return (len);
+}
+
+/* Capture thread: append records to the pcap file */
+static void Drain (FILE *f) {
+  int32_t n;
+
+  while ((n = EMAC_CaptureRead (Rec, sizeof(Rec))) > 0) {
+    (void)fwrite (Rec, 1U, (size_t)n, f);
+  }
+  Check (n == 0, "EMAC_CaptureRead", (uint32_t)n, 0U);
+}
+
+/* Read the pcap file back and check the records */
+static void Verify (const char *name, uint32_t frames, uint32_t snap, uint32_t sample) {
+  FILE    *f;
+  uint32_t hdr[6], rec[4];
+  uint32_t next[2], cnt[2];
+  uint32_t seq, dir, len, i;
+  uint64_t t, t_last;
+
+  f = fopen (name, "rb");
+  if (f == NULL) {
+    Check (0, "open pcap file", 0U, 0U);
+    return;
+  }
+  Check (fread (hdr, sizeof(hdr), 1U, f) == 1U, "pcap file header", 0U, 0U);
+  Check ((hdr[0] == 0xA1B2C3D4U) && (hdr[5] == 1U), "pcap magic and link type", hdr[0], hdr[5]);
+
+  next[DIR_RX] = 0U;
+  next[DIR_TX] = 0U;
+  cnt[DIR_RX]  = 0U;
+  cnt[DIR_TX]  = 0U;
+  t_last       = 0U;
+  while (fread (rec, sizeof(rec), 1U, f) == 1U) {
+    t = ((uint64_t)rec[0] * 1000000U) + rec[1];
+    Check (t >= t_last, "timestamp order", (uint32_t)t, (uint32_t)t_last);
+    t_last = t;
+    if ((rec[2] > sizeof(Frame)) || (fread (Frame, rec[2], 1U, f) != 1U) || (rec[2] < 19U)) {
+      Check (0, "record length", rec[2], rec[3]);
+      break;
+    }
+    memcpy (&seq, &Frame[14], 4U);
+    dir = Frame[18] & 1U;
+    len = Length (seq);
+    Check (seq == next[dir], "record order", seq, next[dir]);
+    Check ((rec[3] == len) && (rec[2] == ((len < snap) ? len : snap)), "record size", rec[2], rec[3]);
+    for (i = 19U; i < rec[2]; i++) {
+      if (Frame[i] != (uint8_t)(seq + i + dir)) {
+        Check (0, "record data", seq, i);
+        break;
+      }
+    }
+    next[dir] = seq + sample;
+    cnt[dir]++;
+  }
+  fclose (f);
+
+  printf ("%s: %u received and %u transmitted frames captured\n", name, (unsigned)cnt[DIR_RX],
+          (unsigned)cnt[DIR_TX]);
+  Check (cnt[DIR_RX] == ((frames + sample - 1U) / sample), "received frames captured", cnt[DIR_RX], frames);
+  Check (cnt[DIR_TX] == ((frames + sample - 1U) / sample), "transmitted frames captured", cnt[DIR_TX], frames);
+}
+
+int main (int argc, char *argv[]) {
+  const char *name   = (argc > 1) ? argv[1] : "emac_capture.pcap";
+  uint32_t    frames = (argc > 2) ? (uint32_t)strtoul (argv[2], NULL, 0) : 2000U;
+  uint32_t    snap   = (argc > 3) ? (uint32_t)strtoul (argv[3], NULL, 0) : FRAME_MAX;
+  uint32_t    sample = (argc > 4) ? (uint32_t)strtoul (argv[4], NULL, 0) : 1U;
+  EMAC_FRAME  fr;
+  EMAC_STATS  stats;
+  FILE       *f;
+  uint32_t    seq, len;
+
+  if ((frames == 0U) || (snap == 0U) || (snap > FRAME_MAX) || (sample == 0U)) {
+    printf ("usage: emac_capture_dump [file] [frames] [snaplen] [sample]\n");
+    return (2);
+  }
+  f = fopen (name, "wb");
+  if (f == NULL) {
+    printf ("cannot create %s\n", name);
+    return (2);
+  }
+
+  Host_Init (1U);
+  (void)Mac->Initialize (NULL);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 1U);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  len = EMAC_CaptureHeader (Rec);
+  (void)fwrite (Rec, 1U, len, f);
+  Check (EMAC_CaptureStart (snap, sample) == ARM_DRIVER_OK, "EMAC_CaptureStart", 0U, 0U);
+
+  for (seq = 0U; seq < frames; seq++) {
+    (void)ENET_ModelRx (Frame, Generate (Frame, DIR_RX, seq));
+    Host_Advance (20000U);
+    if ((seq & 1U) == 0U) {
+      len = Mac->GetRxFrameSize ();
+      Check (Mac->ReadFrame (Frame, len) == (int32_t)Length (seq), "ReadFrame", seq, len);
+    } else {
+      fr.data = Frame;
+      fr.len  = sizeof(Frame);
+      Check (EMAC_ReadFrames (&fr, 1U) == 1, "EMAC_ReadFrames", seq, 0U);
+    }
+
+    len = Generate (Frame, DIR_TX, seq);
+    Check (Mac->SendFrame (Frame, len, 0U) == ARM_DRIVER_OK, "SendFrame", seq, len);
+    Host_Advance (20000U);
+
+    if ((seq & 1U) != 0U) {
+      Drain (f);
+    }
+  }
+  (void)EMAC_CaptureStop ();
+  Drain (f);
+  fclose (f);
+
+  (void)EMAC_GetStatistics (&stats);
+  Check (stats.cap_drop == 0U, "frames not captured", stats.cap_drop, 0U);
+
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 0U);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 0U);
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  Verify (name, frames, snap, sample);
+
+  if (Fails != 0U) {
+    printf ("%u checks failed\n", (unsigned)Fails);
+    return (1);
+  }
+  printf ("All checks passed\n");
+  return (0);
+}
@@ -0,0 +1,274 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host receive latency of a high priority class under bulk load
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in virtual time (see ENET_Model.h)
+  and measures the receive latency of high priority frames (64 byte PTP
+  frames, ethertype 0x88F7) which arrive between bulk frames (1514 bytes) on a
+  100 Mbit/s link. Build the FIFO path and the priority class path and run
+  both from the repository root:
+
+    for cls in 0 2; do
+      gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+          -ITest/EMAC_Host -ICMSIS/Driver -DEMAC_RX_BUF_CNT=32 -DEMAC_RX_CLASS_CNT=$cls
+          Test/EMAC_Host/EMAC_ClassLatency.c Test/EMAC_Host/Host_Core.c Test/EMAC_Host/ENET_Model.c
+          CMSIS/Driver/EMAC_iMXRT105x.c -o emac_class_latency && ./emac_class_latency
+    done
+    ./emac_class_latency [load] [interval] [read] [msec]
+
+  load is the bulk load in percent of the link (default 100: back to back),
+  interval the time between high priority frames in us (default 500), read
+  the application time per received byte in ns (default 100, slower than
+  the link, so a bulk backlog builds up) and msec the run time (default 200).
+  With EMAC_RX_CLASS_CNT the frames with ethertype 0x88F7 are sorted into
+  the highest class. The application thread is woken by the receive event
+  after 20 us and reads frames with ReadFrame (strict priority draining)
+  until no frame is left. Latency is the time from the frame arriving in
+  the receive descriptor to ReadFrame. The program returns 0 when every
+  frame was either read intact and in order within its class or counted as
+  dropped, and with classes when no high priority frame waited longer than
+  the wakeup and the read of one bulk frame.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+#define LINK_NS_PER_BYTE  80U           /* 100 Mbit/s                                 */
+#define LINK_OVERHEAD     24U           /* FCS, preamble and inter-frame gap in bytes */
+#define WAKE_NS           20000U        /* Application wakeup latency                 */
+#define BULK_LEN          1514U
+#define HP_LEN            64U
+#define HP_TYPE           0x88F7U       /* PTP                                        */
+#define BULK_TYPE         0x88B5U
+#define NEVER             UINT64_MAX
+
+/* Driver defaults, for the report only */
+#ifndef EMAC_RX_BUF_CNT
+  #define EMAC_RX_BUF_CNT   4U
+#endif
+#ifndef EMAC_RX_CLASS_CNT
+  #define EMAC_RX_CLASS_CNT 0U
+#endif
+
+typedef struct {
+  const char *name;
+  uint32_t    sent;
+  uint32_t    read;
+  uint32_t    seq;                      /* Next sequence number to send               */
+  uint32_t    seq_read;                 /* Next sequence number expected              */
+  uint64_t    lat_sum;
+  uint64_t    lat_max;
+} CLASS_STATS;
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static uint8_t     Frame[1536];
+static uint32_t    Read_Ns = 100U;
+static uint64_t    App_Next;            /* Time of next application read              */
+static uint32_t    Cnt_Bad;
+static CLASS_STATS Bulk = { "bulk" };
+static CLASS_STATS Hp   = { "high priority" };
+
+/* Frame carries its sequence number within the class and the time it was sent */
+static uint32_t Generate (uint8_t *frame, uint16_t type, uint32_t seq, uint32_t len) {
+  uint64_t time = Host_Time ();
+  uint32_t i;
+
+  memcpy (&frame[0], MacAddr, 6U);
+  memcpy (&frame[6], "\x02\x00\x00\x00\x00\x02", 6U);
+  frame[12] = (uint8_t)(type >> 8);
+  frame[13] = (uint8_t)type;
+  memcpy (&frame[14], &seq, 4U);
+  memcpy (&frame[18], &time, 8U);
+  for (i = 26U; i < len; i++) {
+    frame[i] = (uint8_t)(seq + i);
+  }
+  return (len);
+}
+
+/* Received frames must be intact and in order within their class, gaps are drops */
+static void Check (const uint8_t *frame, int32_t len) {
+  CLASS_STATS *cs;
+  uint64_t     time;
+  uint32_t     seq, i;
+
+  if (len < 26) {
+    Cnt_Bad++;
+    return;
+  }
+  cs = ((((uint32_t)frame[12] << 8) | frame[13]) == HP_TYPE) ? &Hp : &Bulk;
+  memcpy (&seq,  &frame[14], 4U);
+  memcpy (&time, &frame[18], 8U);
+  if (seq < cs->seq_read) {
+    Cnt_Bad++;
+    return;
+  }
+  for (i = 26U; i < (uint32_t)len; i++) {
+    if (frame[i] != (uint8_t)(seq + i)) {
+      Cnt_Bad++;
+      return;
+    }
+  }
+  cs->seq_read = seq + 1U;
+  cs->read++;
+
+  time = Host_Time () - time;
+  cs->lat_sum += time;
+  if (time > cs->lat_max) {
+    cs->lat_max = time;
+  }
+}
+
+/* Receive event (ENET interrupt): wake the application thread */
+static void MAC_Event (uint32_t event) {
+  if (((event & ARM_ETH_MAC_EVENT_RX_FRAME) != 0U) && (App_Next == NEVER)) {
+    App_Next = Host_Time () + WAKE_NS;
+  }
+}
+
+/* Let time pass until t, the application reads frames when it is scheduled */
+static void RunUntil (uint64_t t) {
+  uint32_t len;
+  int32_t  rc;
+
+  while (App_Next <= t) {
+    Host_Advance (App_Next - Host_Time ());
+    len = Mac->GetRxFrameSize ();
+    if (len == 0U) {
+      App_Next = NEVER;
+      continue;
+    }
+    rc = Mac->ReadFrame (Frame, (len <= sizeof(Frame)) ? len : 0U);
+    Check (Frame, rc);
+    App_Next += (uint64_t)len * Read_Ns;
+  }
+  Host_Advance (t - Host_Time ());
+}
+
+static void Report (const CLASS_STATS *cs, uint32_t drop) {
+  printf ("  %-14s %8u %8u %8u %10.1f %10.1f\n", cs->name, (unsigned)cs->sent, (unsigned)cs->read,
+          (unsigned)drop, (cs->read != 0U) ? (((double)cs->lat_sum / cs->read) / 1000.0) : 0.0,
+          (double)cs->lat_max / 1000.0);
+}
+
+int main (int argc, char *argv[]) {
+  uint32_t load     = (argc > 1) ? (uint32_t)strtoul (argv[1], NULL, 0) : 100U;
+  uint32_t interval = (argc > 2) ? (uint32_t)strtoul (argv[2], NULL, 0) : 500U;
+  uint32_t msec     = (argc > 4) ? (uint32_t)strtoul (argv[4], NULL, 0) : 200U;
+  uint64_t t, end, next_hp, bulk_ns;
+  uint32_t drop, drop_hp, drop_bulk;
+  int32_t  rc = 0;
+#if (EMAC_RX_CLASS_CNT > 0U)
+  EMAC_RX_RULE rule;
+  uint64_t     limit;
+#endif
+
+  if (argc > 3) { Read_Ns = (uint32_t)strtoul (argv[3], NULL, 0); }
+  if ((load == 0U) || (load > 100U) || (interval == 0U) || (msec == 0U)) {
+    printf ("usage: emac_class_latency [load] [interval] [read] [msec]\n");
+    return (2);
+  }
+
+  Host_Init (1U);
+  App_Next = NEVER;
+
+  (void)Mac->Initialize (MAC_Event);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL);
+#if (EMAC_RX_CLASS_CNT > 0U)
+  /* PTP frames into the highest class, everything else into class 0 */
+  memset (&rule, 0, sizeof(rule));
+  rule.match     = EMAC_RX_MATCH_ETHERTYPE;
+  rule.cls       = EMAC_RX_CLASS_CNT - 1U;
+  rule.ethertype = HP_TYPE;
+  if (EMAC_SetRxRule (0U, &rule) != ARM_DRIVER_OK) {
+    printf ("EMAC_SetRxRule failed\n");
+    return (1);
+  }
+#endif
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  /* Bulk frame followed by the idle time of the configured load */
+  bulk_ns = ((uint64_t)(BULK_LEN + LINK_OVERHEAD) * LINK_NS_PER_BYTE * 100U) / load;
+
+  t       = Host_Time ();
+  end     = t + ((uint64_t)msec * 1000000U);
+  next_hp = t + ((uint64_t)interval * 1000U);
+  drop    = (uint32_t)ENET_ModelStats.rx_drop;
+  while (t < end) {
+    RunUntil (t);
+    if (t >= next_hp) {
+      (void)ENET_ModelRx (Frame, Generate (Frame, HP_TYPE, Hp.seq++, HP_LEN));
+      Hp.sent++;
+      t       += (uint64_t)(HP_LEN + LINK_OVERHEAD) * LINK_NS_PER_BYTE;
+      next_hp += (uint64_t)interval * 1000U;
+      continue;
+    }
+    (void)ENET_ModelRx (Frame, Generate (Frame, BULK_TYPE, Bulk.seq++, BULK_LEN));
+    Bulk.sent++;
+    t += bulk_ns;
+  }
+  /* Drain the ring */
+  RunUntil (t + 1000000000U);
+  drop = (uint32_t)ENET_ModelStats.rx_drop - drop;
+
+  /* Drops per class: frames neither read nor corrupted */
+  drop_hp   = Hp.sent   - Hp.read;
+  drop_bulk = Bulk.sent - Bulk.read;
+
+  printf ("EMAC_RX_BUF_CNT %u, EMAC_RX_CLASS_CNT %u, bulk load %u %%, high priority every %u us, "
+          "read %u ns/byte\n", (unsigned)EMAC_RX_BUF_CNT, (unsigned)EMAC_RX_CLASS_CNT, (unsigned)load,
+          (unsigned)interval, (unsigned)Read_Ns);
+  printf ("  %-14s %8s %8s %8s %10s %10s\n", "class", "sent", "read", "dropped", "lat [us]", "max [us]");
+  Report (&Hp,   drop_hp);
+  Report (&Bulk, drop_bulk);
+
+  if ((Cnt_Bad != 0U) || ((drop_hp + drop_bulk) != drop)) {
+    printf ("  %u frames corrupted or out of order, %u frames lost without drop count\n", (unsigned)Cnt_Bad,
+            (unsigned)((drop_hp + drop_bulk) - drop));
+    rc = 1;
+  }
+#if (EMAC_RX_CLASS_CNT > 0U)
+  /* Strict priority: a high priority frame waits at most for the wakeup and one bulk frame being read */
+  limit = WAKE_NS + ((uint64_t)BULK_LEN * Read_Ns) + ((uint64_t)HP_LEN * Read_Ns);
+  if (Hp.lat_max > limit) {
+    printf ("  high priority latency above %.1f us\n", (double)limit / 1000.0);
+    rc = 1;
+  }
+#endif
+
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 0U);
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  return (rc);
+}
@@ -0,0 +1,247 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host receive interrupt rate per interrupt coalescing mode
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in virtual time (see ENET_Model.h)
+  and measures the receive interrupt rate and the receive latency for
+  per-frame interrupts, fixed coalescing (EMAC_CONTROL_RX_COALESCE) and
+  adaptive coalescing (EMAC_CONTROL_RX_COALESCE_ADAPTIVE) at several frame
+  rates of 60 byte frames, up to a 100 Mbit/s flood. Build and run from the
+  repository root:
+
+    gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+        -ITest/EMAC_Host -ICMSIS/Driver -DEMAC_RX_BUF_CNT=64 Test/EMAC_Host/EMAC_IrqRate.c
+        Test/EMAC_Host/Host_Core.c Test/EMAC_Host/ENET_Model.c CMSIS/Driver/EMAC_iMXRT105x.c
+        -o emac_irq_rate
+    ./emac_irq_rate [frames usec] [msec]
+
+  frames and usec are the fixed coalescing thresholds and the adaptive
+  maxima (default 16 frames, 100 us), msec is the run time per frame rate
+  (default 100). The application thread is woken by the receive event and
+  reads frames with ReadFrame, 1 us per frame, until the ring is empty.
+  Latency is the time from the frame arriving in the receive descriptor to
+  ReadFrame. The program also runs with -DEMAC_EVENT_THREAD=1. It returns 0
+  when every frame was either read intact or counted as dropped.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+#define FRAME_LEN       60U
+#define FRAME_NS        6720U           /* 60 bytes, FCS, preamble and gap at 100 Mbit/s */
+#define READ_NS         1000U           /* Application time per frame read            */
+#define NEVER           UINT64_MAX
+
+/* Driver default, for the report only */
+#ifndef EMAC_RX_BUF_CNT
+  #define EMAC_RX_BUF_CNT   4U
+#endif
+
+typedef struct {
+  const char *name;
+  uint32_t    control;                  /* 0 = coalescing disabled */
+} MODE;
+
+static const MODE Modes[] = {
+  { "per frame", 0U                                },
+  { "fixed",     EMAC_CONTROL_RX_COALESCE          },
+  { "adaptive",  EMAC_CONTROL_RX_COALESCE_ADAPTIVE }
+};
+
+/* Frame rates in frames/s, the last one is the 100 Mbit/s flood */
+static const uint32_t Rates[] = { 1000U, 10000U, 50000U, 1000000000U / FRAME_NS };
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static uint8_t  Frame[1536];
+static uint64_t App_Next;               /* Time of next application read             */
+static uint64_t Lat_Sum;
+static uint64_t Lat_Max;
+static uint32_t Cnt_Read;
+static uint32_t Cnt_Bad;
+
+/* Frame carries the time it was sent */
+static uint32_t Generate (uint8_t *frame, uint64_t time) {
+  uint32_t i;
+
+  memcpy (&frame[0], MacAddr, 6U);
+  memcpy (&frame[6], "\x02\x00\x00\x00\x00\x02", 6U);
+  frame[12] = 0x88U;
+  frame[13] = 0xB5U;
+  memcpy (&frame[14], &time, 8U);
+  for (i = 22U; i < FRAME_LEN; i++) {
+    frame[i] = (uint8_t)i;
+  }
+  return (FRAME_LEN);
+}
+
+static void Check (const uint8_t *frame, int32_t len) {
+  uint64_t time;
+
+  if (len != (int32_t)FRAME_LEN) {
+    Cnt_Bad++;
+    return;
+  }
+  memcpy (&time, &frame[14], 8U);
+  time = Host_Time () - time;
+  Lat_Sum += time;
+  if (time > Lat_Max) {
+    Lat_Max = time;
+  }
+}
+
+/* Receive event (ENET interrupt): wake the application thread */
+static void MAC_Event (uint32_t event) {
+  if (((event & ARM_ETH_MAC_EVENT_RX_FRAME) != 0U) && (App_Next == NEVER)) {
+    App_Next = Host_Time ();
+  }
+}
+
+/* Let time pass until t, the application reads frames when it is scheduled.
+   Time advances at most to the next coalescing timer, whose interrupt wakes the application. */
+static void RunUntil (uint64_t t) {
+  uint64_t dl;
+  uint32_t len;
+
+  for (;;) {
+    /* Driver event thread (EMAC_EVENT_THREAD) runs */
+    Host_Yield ();
+    if (App_Next <= t) {
+      Host_Advance (App_Next - Host_Time ());
+      len = Mac->GetRxFrameSize ();
+      if (len == 0U) {
+        App_Next = NEVER;
+        continue;
+      }
+      Check (Frame, Mac->ReadFrame (Frame, (len <= sizeof(Frame)) ? len : 0U));
+      Cnt_Read++;
+      App_Next += READ_NS;
+      continue;
+    }
+    if (Host_Time () >= t) {
+      break;
+    }
+    dl = ENET_ModelDeadline ();
+    if (dl < Host_Time ()) {
+      dl = Host_Time ();
+    }
+    Host_Advance (((dl < t) ? dl : t) - Host_Time ());
+  }
+}
+
+static int32_t Run (uint32_t rate, uint32_t msec) {
+  uint64_t t, end, irq0, drop0;
+  uint32_t sent, drop;
+  double   sec;
+
+  irq0     = Host_Stats.irq_cnt;
+  drop0    = ENET_ModelStats.rx_drop;
+  Cnt_Read = 0U;
+  Lat_Sum  = 0U;
+  Lat_Max  = 0U;
+
+  sent = 0U;
+  t    = Host_Time ();
+  end  = t + ((uint64_t)msec * 1000000U);
+  while (t < end) {
+    RunUntil (t);
+    (void)ENET_ModelRx (Frame, Generate (Frame, Host_Time ()));
+    sent++;
+    t += 1000000000U / rate;
+  }
+  sec = (double)(t - (end - ((uint64_t)msec * 1000000U))) / 1e9;
+
+  /* Drain the ring, coalescing timers expire */
+  RunUntil (t + 10000000U);
+  drop = (uint32_t)(ENET_ModelStats.rx_drop - drop0);
+
+  printf ("  %8u %10.0f %8.2f %9.1f %9.1f %7.2f %%\n", (unsigned)rate,
+          (double)(Host_Stats.irq_cnt - irq0) / sec, (double)Cnt_Read / (double)(Host_Stats.irq_cnt - irq0),
+          (Cnt_Read != 0U) ? (((double)Lat_Sum / Cnt_Read) / 1000.0) : 0.0, (double)Lat_Max / 1000.0,
+          (drop * 100.0) / sent);
+
+  if ((Cnt_Read + drop) != sent) {
+    printf ("  %u frames lost without drop count\n", (unsigned)(sent - Cnt_Read - drop));
+    return (1);
+  }
+  return (0);
+}
+
+int main (int argc, char *argv[]) {
+  uint32_t frames = 16U;
+  uint32_t usec   = 100U;
+  uint32_t msec   = 100U;
+  int32_t  rc     = 0;
+  uint32_t m, r;
+
+  if (argc > 2) {
+    frames = (uint32_t)strtoul (argv[1], NULL, 0);
+    usec   = (uint32_t)strtoul (argv[2], NULL, 0);
+  }
+  if (argc > 3) { msec = (uint32_t)strtoul (argv[3], NULL, 0); }
+  if ((frames < 2U) || (frames > 255U) || (usec == 0U) || (usec > 0xFFFFU) || (msec == 0U)) {
+    printf ("usage: emac_irq_rate [frames usec] [msec]\n");
+    return (2);
+  }
+
+  Host_Init (1U);
+  App_Next = NEVER;
+
+  (void)Mac->Initialize (MAC_Event);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  printf ("EMAC_RX_BUF_CNT %u, coalescing %u frames, %u us, %u ms per rate\n", (unsigned)EMAC_RX_BUF_CNT,
+          (unsigned)frames, (unsigned)usec, (unsigned)msec);
+  for (m = 0U; (m < (sizeof(Modes) / sizeof(Modes[0]))) && (rc == 0); m++) {
+    (void)Mac->Control (EMAC_CONTROL_RX_COALESCE, 0U);
+    if (Modes[m].control != 0U) {
+      (void)Mac->Control (Modes[m].control, EMAC_COALESCE_ARG (frames, usec));
+    }
+    printf ("%s\n", Modes[m].name);
+    printf ("  %8s %10s %8s %9s %9s %9s\n", "frames/s", "irq/s", "frm/irq", "lat [us]", "max [us]", "drop");
+    for (r = 0U; (r < (sizeof(Rates) / sizeof(Rates[0]))) && (rc == 0); r++) {
+      rc = Run (Rates[r], msec);
+    }
+  }
+  if ((rc == 0) && (Cnt_Bad != 0U)) {
+    printf ("%u frames corrupted\n", (unsigned)Cnt_Bad);
+    rc = 1;
+  }
+
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 0U);
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  return (rc);
+}
@@ -0,0 +1,272 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host test for zero-copy receive buffer ownership
+ * -------------------------------------------------------------------------- */
+
+/*
+  Checks buffer ownership of EMAC_LoanRxFrame and EMAC_ReleaseRxFrame on the
+  ENET model in virtual time (see ENET_Model.h): loaned buffers are never in
+  the receive ring, the DMA does not write into them, exhausted spare buffers
+  return busy and keep the frame in the ring, and releasing a buffer twice or
+  releasing a buffer which is not on loan is rejected. Small frames are copied
+  into slabs at receive time, so more small frames than receive descriptors
+  are held without drops. Build and run from the repository root, with and
+  without the small frame slab pool:
+
+    gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+        -ITest/EMAC_Host -ICMSIS/Driver -DEMAC_RX_LOAN_CNT=4 [-DEMAC_RX_SLAB_CNT=8]
+        Test/EMAC_Host/EMAC_LoanTest.c Test/EMAC_Host/Host_Core.c Test/EMAC_Host/ENET_Model.c
+        CMSIS/Driver/EMAC_iMXRT105x.c -o emac_loan_test
+    ./emac_loan_test
+
+  The program returns 0 when all tests pass.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+/* Driver defaults */
+#ifndef EMAC_RX_BUF_CNT
+  #define EMAC_RX_BUF_CNT       4U
+#endif
+#ifndef EMAC_RX_LOAN_CNT
+  #define EMAC_RX_LOAN_CNT      0U
+#endif
+#ifndef EMAC_RX_SLAB_CNT
+  #define EMAC_RX_SLAB_CNT      0U
+#endif
+#ifndef EMAC_RX_SLAB_SIZE
+  #define EMAC_RX_SLAB_SIZE     128U
+#endif
+
+#define BUF_SIZE        1536U
+#define LEN_LARGE       1000U
+#define LEN_SMALL       60U
+
+#if (EMAC_RX_LOAN_CNT > 0U)
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static uint8_t   Frame[BUF_SIZE];
+static uint32_t  Seq;
+static uint32_t  Fails;
+
+static void Check (int cond, const char *name, uint32_t a, uint32_t b) {
+  if (!cond) {
+    if (Fails < 20U) {
+      printf ("FAIL %s (%u, %u)\n", name, (unsigned)a, (unsigned)b);
+    }
+    Fails++;
+  }
+}
+
+/* Receive frame with sequence number seq and pattern */
+static void Receive (uint32_t len) {
+  uint32_t i;
+
+  memcpy (&Frame[0], MacAddr, 6U);
+  memcpy (&Frame[6], "\x02\x00\x00\x00\x00\x02", 6U);
+  Frame[12] = 0x88U;
+  Frame[13] = 0xB5U;
+  memcpy (&Frame[14], &Seq, 4U);
+  for (i = 18U; i < len; i++) {
+    Frame[i] = (uint8_t)(Seq + i);
+  }
+  Seq++;
+  (void)ENET_ModelRx (Frame, len);
+  Host_Advance (10000U);
+}
+
+/* Frame content intact: returns sequence number, or UINT32_MAX */
+static uint32_t Content (const uint8_t *frame, int32_t len) {
+  uint32_t seq, i;
+
+  if (len < 18) {
+    return (UINT32_MAX);
+  }
+  memcpy (&seq, &frame[14], 4U);
+  for (i = 18U; i < (uint32_t)len; i++) {
+    if (frame[i] != (uint8_t)(seq + i)) {
+      return (UINT32_MAX);
+    }
+  }
+  return (seq);
+}
+
+/* Receive ring: descriptors own distinct buffers, none of them is on loan */
+static void CheckRing (uint8_t *const *loan, uint32_t num, const char *name) {
+  volatile enet_rx_bd_struct_t *bd = (volatile enet_rx_bd_struct_t *)(uintptr_t)ENET->RDSR;
+  uint32_t i, j;
+  uint8_t *buf[EMAC_RX_BUF_CNT];
+
+  for (i = 0U; i < EMAC_RX_BUF_CNT; i++) {
+    buf[i] = (uint8_t *)(uintptr_t)bd[i].buffer;
+    for (j = 0U; j < i; j++) {
+      Check (buf[i] != buf[j], name, i, j);
+    }
+    for (j = 0U; j < num; j++) {
+      Check ((loan[j] == NULL) || (loan[j] < buf[i]) || (loan[j] >= (buf[i] + BUF_SIZE)), name, i, j);
+    }
+  }
+  Check ((bd[EMAC_RX_BUF_CNT - 1U].control & ENET_BUFFDESCRIPTOR_RX_WRAP_MASK) != 0U, name, 0U, 0U);
+}
+
+/* Loan all spare buffers, check busy, release and double release */
+static void TestLoan (void) {
+  uint8_t *loan[EMAC_RX_LOAN_CNT + 1U];
+  uint8_t  copy[EMAC_RX_LOAN_CNT][LEN_LARGE];
+  uint8_t *ptr;
+  uint32_t seq0, i;
+  int32_t  len;
+
+  Check (EMAC_LoanRxFrame (&ptr) == 0, "loan without frame", 0U, 0U);
+  Check (EMAC_LoanRxFrame (NULL) == ARM_DRIVER_ERROR_PARAMETER, "loan NULL", 0U, 0U);
+
+  /* Loan every spare buffer */
+  seq0 = Seq;
+  for (i = 0U; i < EMAC_RX_LOAN_CNT; i++) {
+    Receive (LEN_LARGE);
+    len = EMAC_LoanRxFrame (&loan[i]);
+    Check (len == (int32_t)LEN_LARGE, "loan length", i, (uint32_t)len);
+    Check (Content (loan[i], len) == (seq0 + i), "loan content", i, 0U);
+    memcpy (copy[i], loan[i], LEN_LARGE);
+  }
+  loan[EMAC_RX_LOAN_CNT] = NULL;
+  CheckRing (loan, EMAC_RX_LOAN_CNT, "ring owns loaned buffer");
+
+  /* DMA keeps filling the ring, loaned buffers are not written */
+  for (i = 0U; i < (EMAC_RX_BUF_CNT - 1U); i++) {
+    Receive (LEN_LARGE);
+  }
+  for (i = 0U; i < EMAC_RX_LOAN_CNT; i++) {
+    Check (memcmp (copy[i], loan[i], LEN_LARGE) == 0, "loaned buffer overwritten", i, 0U);
+  }
+
+  /* No spare buffer left: busy, frame stays in the ring */
+  Check (EMAC_LoanRxFrame (&ptr) == ARM_DRIVER_ERROR_BUSY, "loan busy", 0U, 0U);
+  Check (Mac->GetRxFrameSize () == LEN_LARGE, "frame kept after busy", 0U, 0U);
+
+  /* Release returns one spare, the next loan gets the frame kept in the ring */
+  Check (EMAC_ReleaseRxFrame (loan[0]) == ARM_DRIVER_OK, "release", 0U, 0U);
+  Check (EMAC_ReleaseRxFrame (loan[0]) == ARM_DRIVER_ERROR_PARAMETER, "double release", 0U, 0U);
+  len = EMAC_LoanRxFrame (&loan[0]);
+  Check (Content (loan[0], len) == (seq0 + EMAC_RX_LOAN_CNT), "loan after release", 0U, 0U);
+  CheckRing (loan, EMAC_RX_LOAN_CNT, "ring owns loaned buffer after release");
+
+  /* Invalid release: foreign buffer, pointer into the ring */
+  Check (EMAC_ReleaseRxFrame (Frame) == ARM_DRIVER_ERROR_PARAMETER, "release foreign buffer", 0U, 0U);
+  ptr = (uint8_t *)(uintptr_t)((volatile enet_rx_bd_struct_t *)(uintptr_t)ENET->RDSR)[0].buffer;
+  Check (EMAC_ReleaseRxFrame (ptr) == ARM_DRIVER_ERROR_PARAMETER, "release ring buffer", 0U, 0U);
+
+  /* Release all, each exactly once */
+  for (i = 0U; i < EMAC_RX_LOAN_CNT; i++) {
+    Check (EMAC_ReleaseRxFrame (loan[i]) == ARM_DRIVER_OK, "release all", i, 0U);
+  }
+  for (i = 0U; i < EMAC_RX_LOAN_CNT; i++) {
+    Check (EMAC_ReleaseRxFrame (loan[i]) == ARM_DRIVER_ERROR_PARAMETER, "double release all", i, 0U);
+  }
+
+  /* Frames left in the ring are read by copy */
+  while ((len = (int32_t)Mac->GetRxFrameSize ()) != 0) {
+    len = Mac->ReadFrame (Frame, (uint32_t)len);
+    Check (Content (Frame, len) != UINT32_MAX, "read after loans", (uint32_t)len, 0U);
+  }
+  CheckRing (NULL, 0U, "ring after release");
+}
+
+/* Small frames: copied into slabs at receive time, descriptors re-armed in place */
+static void TestSlab (void) {
+#if (EMAC_RX_SLAB_CNT > 0U)
+  volatile enet_rx_bd_struct_t *bd = (volatile enet_rx_bd_struct_t *)(uintptr_t)ENET->RDSR;
+  uint8_t *slab[EMAC_RX_SLAB_CNT];
+  uint8_t *ring, *ptr;
+  uint32_t seq0, i;
+  int32_t  len;
+
+  seq0 = Seq;
+  ring = (uint8_t *)(uintptr_t)bd[0].buffer;
+  for (i = 0U; i < EMAC_RX_SLAB_CNT; i++) {
+    Receive (LEN_SMALL);
+  }
+  for (i = 0U; i < EMAC_RX_BUF_CNT; i++) {
+    Check ((bd[i].control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) != 0U, "slab copy at receive time", i, 0U);
+  }
+  for (i = 0U; i < EMAC_RX_SLAB_CNT; i++) {
+    len = EMAC_LoanRxFrame (&slab[i]);
+    Check (len == (int32_t)LEN_SMALL, "slab length", i, (uint32_t)len);
+    Check (Content (slab[i], len) == (seq0 + i), "slab content", i, 0U);
+  }
+  CheckRing (slab, EMAC_RX_SLAB_CNT, "ring owns slab buffer");
+  Check (ring == (uint8_t *)(uintptr_t)bd[0].buffer, "slab re-arms in place", 0U, 0U);
+
+  /* Slab pool exhausted: small frame is loaned from the spare pool */
+  Receive (LEN_SMALL);
+  len = EMAC_LoanRxFrame (&ptr);
+  Check (len == (int32_t)LEN_SMALL, "small frame from spare pool", 0U, (uint32_t)len);
+  Check (EMAC_ReleaseRxFrame (ptr) == ARM_DRIVER_OK, "release spare", 0U, 0U);
+
+  for (i = 0U; i < EMAC_RX_SLAB_CNT; i++) {
+    Check (EMAC_ReleaseRxFrame (slab[i]) == ARM_DRIVER_OK, "release slab", i, 0U);
+    Check (EMAC_ReleaseRxFrame (slab[i]) == ARM_DRIVER_ERROR_PARAMETER, "double release slab", i, 0U);
+  }
+#endif
+}
+
+int main (void) {
+
+  Host_Init (1U);
+  (void)Mac->Initialize (NULL);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  TestLoan ();
+  TestSlab ();
+  Check (ENET_ModelStats.rx_drop == 0U, "frames dropped", (uint32_t)ENET_ModelStats.rx_drop, 0U);
+
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  if (Fails != 0U) {
+    printf ("%u checks failed\n", (unsigned)Fails);
+    return (1);
+  }
+  printf ("All checks passed (EMAC_RX_LOAN_CNT %u, EMAC_RX_SLAB_CNT %u)\n",
+          (unsigned)EMAC_RX_LOAN_CNT, (unsigned)EMAC_RX_SLAB_CNT);
+  return (0);
+}
+
+#else
+
+int main (void) {
+  printf ("Build with EMAC_RX_LOAN_CNT > 0\n");
+  return (2);
+}
+
+#endif
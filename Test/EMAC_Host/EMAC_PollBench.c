@@ -0,0 +1,284 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host receive CPU cost per frame: interrupt versus poll mode
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in virtual time (see ENET_Model.h)
+  and measures the driver CPU cost per received frame with one receive
+  interrupt and event per frame (GetRxFrameSize and ReadFrame until the ring
+  is empty) and in adaptive interrupt/poll mode (EMAC_CONTROL_RX_POLL,
+  EMAC_PollRx with a frame budget until the ring is drained), at several
+  frame rates of 60 byte frames up to a 100 Mbit/s flood. Build and run from
+  the repository root:
+
+    gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+        -ITest/EMAC_Host -ICMSIS/Driver -DEMAC_RX_BUF_CNT=64 Test/EMAC_Host/EMAC_PollBench.c
+        Test/EMAC_Host/Host_Core.c Test/EMAC_Host/ENET_Model.c CMSIS/Driver/EMAC_iMXRT105x.c
+        -o emac_poll_bench
+    ./emac_poll_bench [budget] [read] [msec]
+
+  budget is the EMAC_PollRx frame budget (default 16), read the application
+  (network stack) time per frame in ns (default 5000), msec the run time per
+  frame rate (default 100). The application thread is woken by the receive
+  event 5 us after it is signaled; an event signaled while it runs wakes it
+  again when it is done, like an RTOS thread flag. Reported are receive
+  interrupts, application wakeups (event signals) and driver cycles per
+  frame: in the ENET interrupt handler and in the read calls, host CPU time
+  scaled to SystemCoreClock. Cycle counts compare the modes on the same
+  host, they do not predict Cortex-M7 timing. The program returns 0 when
+  every frame was either read intact and in order or counted as dropped.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+#define FRAME_LEN       60U
+#define FRAME_NS        6720U           /* 60 bytes, FCS, preamble and gap at 100 Mbit/s */
+#define WAKE_NS         5000U           /* Application thread wakeup latency          */
+#define BUDGET_MAX      64U
+#define NEVER           UINT64_MAX
+
+/* Driver default, for the report only */
+#ifndef EMAC_RX_BUF_CNT
+  #define EMAC_RX_BUF_CNT   4U
+#endif
+
+/* Frame rates in frames/s, the last one is the 100 Mbit/s flood */
+static const uint32_t Rates[] = { 10000U, 50000U, 100000U, 1000000000U / FRAME_NS };
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static uint8_t    Frame[1536];
+static uint8_t    Buf[BUDGET_MAX][1536];
+static EMAC_FRAME Frames[BUDGET_MAX];
+static uint32_t   Budget = 16U;
+static uint32_t   Read   = 5000U;      /* Application time per frame in ns           */
+static uint32_t   Poll;                 /* 0 = interrupt mode, 1 = poll mode          */
+static uint64_t   App_Next;             /* Time the application thread runs next      */
+static uint32_t   App_Wake;             /* Thread woken, not yet running              */
+static uint32_t   App_Wait;             /* Thread waits for the event when it runs    */
+static uint32_t   Ev_Pending;           /* Event signaled while the thread runs       */
+static uint64_t   Cyc_Read;
+static uint32_t   Seq;                  /* Next frame sequence number to send         */
+static uint32_t   Seq_Read;             /* Next sequence number expected              */
+static uint32_t   Cnt_Read;
+static uint32_t   Cnt_Wake;
+static uint32_t   Cnt_Bad;
+
+static uint32_t Generate (uint8_t *frame, uint32_t seq) {
+  uint32_t i;
+
+  memcpy (&frame[0], MacAddr, 6U);
+  memcpy (&frame[6], "\x02\x00\x00\x00\x00\x02", 6U);
+  frame[12] = 0x88U;
+  frame[13] = 0xB5U;
+  memcpy (&frame[14], &seq, 4U);
+  for (i = 18U; i < FRAME_LEN; i++) {
+    frame[i] = (uint8_t)(seq + i);
+  }
+  return (FRAME_LEN);
+}
+
+/* Received frames must be intact and in order, gaps are drops */
+static void Check (const uint8_t *frame, uint32_t len) {
+  uint32_t seq;
+
+  memcpy (&seq, &frame[14], 4U);
+  if ((len != FRAME_LEN) || (seq < Seq_Read) || (frame[FRAME_LEN - 1U] != (uint8_t)(seq + FRAME_LEN - 1U))) {
+    Cnt_Bad++;
+    return;
+  }
+  Seq_Read = seq + 1U;
+  Cnt_Read++;
+}
+
+/* Receive event (ENET interrupt): signal the application thread */
+static void MAC_Event (uint32_t event) {
+  if ((event & ARM_ETH_MAC_EVENT_RX_FRAME) == 0U) {
+    return;
+  }
+  if (App_Next == NEVER) {
+    App_Next = Host_Time () + WAKE_NS;
+    App_Wake = 1U;
+    Cnt_Wake++;
+  } else if (App_Wake == 0U) {
+    Ev_Pending = 1U;
+  }
+}
+
+/* Application thread runs: read frames, return the time it needs */
+static uint64_t AppRun (void) {
+  uint64_t t0;
+  uint32_t len;
+  int32_t  n, i;
+
+  if (Poll == 0U) {
+    /* One frame per run, until the ring is empty */
+    t0  = Host_Cycles ();
+    len = Mac->GetRxFrameSize ();
+    if (len == 0U) {
+      Cyc_Read += Host_Cycles () - t0;
+      App_Wait  = 1U;
+      return (0U);
+    }
+    n = Mac->ReadFrame (Frame, (len <= sizeof(Frame)) ? len : 0U);
+    Cyc_Read += Host_Cycles () - t0;
+    Check (Frame, (n > 0) ? (uint32_t)n : 0U);
+    return (Read);
+  }
+
+  /* Poll with budget, wait for the event when the ring is drained */
+  for (i = 0; i < (int32_t)Budget; i++) {
+    Frames[i].data = Buf[i];
+    Frames[i].len  = sizeof(Buf[i]);
+  }
+  t0 = Host_Cycles ();
+  n  = EMAC_PollRx (Frames, Budget);
+  Cyc_Read += Host_Cycles () - t0;
+  for (i = 0; i < n; i++) {
+    Check (Frames[i].data, Frames[i].len);
+  }
+  if ((n < 0) || ((uint32_t)n < Budget)) {
+    App_Wait = 1U;
+  }
+  return ((n > 0) ? ((uint64_t)n * Read) : 0U);
+}
+
+/* Let time pass until t, the application thread runs when it is scheduled */
+static void RunUntil (uint64_t t) {
+  uint64_t dt;
+
+  while (App_Next <= t) {
+    Host_Advance (App_Next - Host_Time ());
+    if (App_Wait != 0U) {
+      /* Thread flag: an event signaled meanwhile wakes the thread again */
+      App_Wait = 0U;
+      if (Ev_Pending != 0U) {
+        Ev_Pending = 0U;
+        App_Next   = Host_Time () + WAKE_NS;
+        App_Wake   = 1U;
+        Cnt_Wake++;
+      } else {
+        App_Next = NEVER;
+      }
+      continue;
+    }
+    App_Wake = 0U;
+    dt = AppRun ();
+    App_Next = Host_Time () + dt;
+  }
+  Host_Advance (t - Host_Time ());
+}
+
+static int32_t Run (uint32_t rate, uint32_t msec) {
+  uint64_t t, end, irq0, irq_cyc0, drop0;
+  uint32_t sent, drop, irq;
+  double   sec;
+
+  irq0     = Host_Stats.irq_cnt;
+  irq_cyc0 = Host_Stats.irq_cycles;
+  drop0    = ENET_ModelStats.rx_drop;
+  Cyc_Read = 0U;
+  Cnt_Read = 0U;
+  Cnt_Wake = 0U;
+  Seq_Read = Seq;
+
+  sent = 0U;
+  t    = Host_Time ();
+  end  = t + ((uint64_t)msec * 1000000U);
+  while (t < end) {
+    RunUntil (t);
+    (void)ENET_ModelRx (Frame, Generate (Frame, Seq++));
+    sent++;
+    t += 1000000000U / rate;
+  }
+  sec = (double)msec / 1000.0;
+
+  /* Drain the ring */
+  RunUntil (t + 10000000U);
+  drop = (uint32_t)(ENET_ModelStats.rx_drop - drop0);
+  irq  = (uint32_t)(Host_Stats.irq_cnt - irq0);
+
+  printf ("  %8u %9.0f %8.3f %8.3f %9.0f %9.0f %9.0f %7.2f %%\n", (unsigned)rate, (double)irq / sec,
+          (double)irq / Cnt_Read, (double)Cnt_Wake / Cnt_Read,
+          (double)(Host_Stats.irq_cycles - irq_cyc0) / Cnt_Read, (double)Cyc_Read / Cnt_Read,
+          (double)((Host_Stats.irq_cycles - irq_cyc0) + Cyc_Read) / Cnt_Read, (drop * 100.0) / sent);
+
+  if ((Cnt_Read + drop) != sent) {
+    printf ("  %u frames lost without drop count\n", (unsigned)(sent - Cnt_Read - drop));
+    return (1);
+  }
+  return (0);
+}
+
+int main (int argc, char *argv[]) {
+  uint32_t msec = 100U;
+  int32_t  rc   = 0;
+  uint32_t r;
+
+  if (argc > 1) { Budget  = (uint32_t)strtoul (argv[1], NULL, 0); }
+  if (argc > 2) { Read    = (uint32_t)strtoul (argv[2], NULL, 0); }
+  if (argc > 3) { msec    = (uint32_t)strtoul (argv[3], NULL, 0); }
+  if ((Budget == 0U) || (Budget > BUDGET_MAX) || (msec == 0U)) {
+    printf ("usage: emac_poll_bench [budget] [read] [msec]\n");
+    return (2);
+  }
+
+  Host_Init (1U);
+  App_Next = NEVER;
+
+  (void)Mac->Initialize (MAC_Event);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  printf ("EMAC_RX_BUF_CNT %u, budget %u, read %u ns/frame, %u ms per rate, cycles per frame\n",
+          (unsigned)EMAC_RX_BUF_CNT, (unsigned)Budget, (unsigned)Read, (unsigned)msec);
+  for (Poll = 0U; (Poll < 2U) && (rc == 0); Poll++) {
+    (void)Mac->Control (EMAC_CONTROL_RX_POLL, Poll);
+    printf ("%s\n", (Poll == 0U) ? "interrupt" : "poll");
+    printf ("  %8s %9s %8s %8s %9s %9s %9s %9s\n", "frames/s", "irq/s", "irq/frm", "wake/frm",
+            "interrupt", "read", "total", "drop");
+    for (r = 0U; (r < (sizeof(Rates) / sizeof(Rates[0]))) && (rc == 0); r++) {
+      rc = Run (Rates[r], msec);
+    }
+  }
+  if ((rc == 0) && (Cnt_Bad != 0U)) {
+    printf ("%u frames corrupted or out of order\n", (unsigned)Cnt_Bad);
+    rc = 1;
+  }
+
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 0U);
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  return (rc);
+}
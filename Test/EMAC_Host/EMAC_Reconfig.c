@@ -0,0 +1,280 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host MAC reconfiguration latency
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in virtual time (see ENET_Model.h)
+  and measures the driver cost of Control(ARM_ETH_MAC_CONFIGURE) for each kind
+  of change: address filter (promiscuous, broadcast reject), duplex mode, link
+  speed, checksum offload and, as reference, loopback, which re-initializes
+  the ENET peripheral. Build and run from the repository root:
+
+    gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+        -ITest/EMAC_Host -ICMSIS/Driver Test/EMAC_Host/EMAC_Reconfig.c Test/EMAC_Host/Host_Core.c
+        Test/EMAC_Host/ENET_Model.c CMSIS/Driver/EMAC_iMXRT105x.c -o emac_reconfig
+    ./emac_reconfig [count]
+
+  Each case switches count times (even, default 1000) between the base
+  configuration (100 Mbit/s, full duplex, broadcast) and the changed one, with
+  received frames waiting in the ring. Reported are driver cycles per
+  Control call (host CPU time scaled to SystemCoreClock), the path taken (on
+  the fly: receive control register only, restart: graceful transmit stop and
+  MAC restart, init: ENET_Init), the frames kept in the receive ring and the
+  frames sent after the reconfiguration. The program returns 0 when every case
+  takes the expected path, the registers hold the new configuration, waiting
+  frames are kept (on the fly) or discarded (restart, init) and every frame
+  sent afterwards is transmitted.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+#define FRAME_LEN       64U
+#define RX_WAIT         2U              /* Received frames waiting during reconfiguration */
+#define BASE_CFG        (ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL | ARM_ETH_MAC_ADDRESS_BROADCAST)
+
+/* Path of the reconfiguration */
+#define PATH_FLY        0U
+#define PATH_RESTART    1U
+#define PATH_INIT       2U
+
+typedef struct {
+  const char *name;
+  uint32_t    cfg;                      /* Changed configuration                  */
+  uint32_t    path;                     /* Expected path                          */
+  uint32_t  (*check) (uint32_t alt);    /* Registers hold base (0) or changed (1) */
+} CASE;
+
+static uint32_t CheckNone (uint32_t alt) {
+  (void)alt;
+  return (1U);
+}
+
+static uint32_t CheckProm (uint32_t alt) {
+  return (((ENET->RCR & ENET_RCR_PROM_MASK) != 0U) == (alt != 0U));
+}
+
+static uint32_t CheckBcRej (uint32_t alt) {
+  return (((ENET->RCR & ENET_RCR_BC_REJ_MASK) != 0U) == (alt != 0U));
+}
+
+static uint32_t CheckHalf (uint32_t alt) {
+  return ((((ENET->RCR & ENET_RCR_DRT_MASK) != 0U) == (alt != 0U)) &&
+          (((ENET->TCR & ENET_TCR_FDEN_MASK) == 0U) == (alt != 0U)));
+}
+
+static uint32_t Check10M (uint32_t alt) {
+  return (((ENET->RCR & ENET_RCR_RMII_10T_MASK) != 0U) == (alt != 0U));
+}
+
+static uint32_t CheckCsum (uint32_t alt) {
+  return (((ENET->RACC != 0U) && (ENET->TACC != 0U)) == (alt != 0U));
+}
+
+static uint32_t CheckLoop (uint32_t alt) {
+  return (((ENET->RCR & ENET_RCR_LOOP_MASK) != 0U) == (alt != 0U));
+}
+
+static const CASE Cases[] = {
+  { "no change",        BASE_CFG,                                                PATH_FLY,     CheckNone  },
+  { "promiscuous",      BASE_CFG | ARM_ETH_MAC_ADDRESS_ALL,                      PATH_FLY,     CheckProm  },
+  { "broadcast reject", BASE_CFG & ~ARM_ETH_MAC_ADDRESS_BROADCAST,               PATH_FLY,     CheckBcRej },
+  { "half duplex",      (BASE_CFG & ~ARM_ETH_MAC_DUPLEX_Msk) | ARM_ETH_MAC_DUPLEX_HALF,
+                                                                                 PATH_RESTART, CheckHalf  },
+  { "10 Mbit/s",        (BASE_CFG & ~ARM_ETH_MAC_SPEED_Msk) | ARM_ETH_MAC_SPEED_10M,
+                                                                                 PATH_RESTART, Check10M   },
+  { "checksum offload", BASE_CFG | ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX | ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX,
+                                                                                 PATH_RESTART, CheckCsum  },
+  { "loopback",         BASE_CFG | ARM_ETH_MAC_LOOPBACK,                         PATH_INIT,    CheckLoop  }
+};
+
+static const char *PathName[] = { "on the fly", "restart", "init" };
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static uint8_t  Frame[1536];
+static uint32_t Seq;                    /* Next receive sequence number to send   */
+static uint32_t Seq_Read;               /* Next receive sequence number expected  */
+static uint32_t Cnt_Tx;
+static uint32_t Cnt_Bad;
+
+static uint32_t Generate (uint8_t *frame, uint32_t seq) {
+  uint32_t i;
+
+  memcpy (&frame[0], MacAddr, 6U);
+  memcpy (&frame[6], "\x02\x00\x00\x00\x00\x02", 6U);
+  frame[12] = 0x88U;
+  frame[13] = 0xB5U;
+  memcpy (&frame[14], &seq, 4U);
+  for (i = 18U; i < FRAME_LEN; i++) {
+    frame[i] = (uint8_t)(seq + i);
+  }
+  return (FRAME_LEN);
+}
+
+/* Received frames must be intact and in order, discarded frames leave a gap */
+static void Check (const uint8_t *frame, int32_t len) {
+  uint32_t seq, i;
+
+  if (len != (int32_t)FRAME_LEN) {
+    Cnt_Bad++;
+    return;
+  }
+  memcpy (&seq, &frame[14], 4U);
+  for (i = 18U; i < FRAME_LEN; i++) {
+    if (frame[i] != (uint8_t)(seq + i)) {
+      break;
+    }
+  }
+  if ((seq < Seq_Read) || (i != FRAME_LEN)) {
+    Cnt_Bad++;
+    return;
+  }
+  Seq_Read = seq + 1U;
+}
+
+static void TxCount (const uint8_t *frame, uint32_t len) {
+  (void)frame;
+  if (len == FRAME_LEN) {
+    Cnt_Tx++;
+  }
+}
+
+static int32_t Run (const CASE *c, uint32_t count) {
+  uint64_t t0, cycles, init0, tx0;
+  uint32_t kept, sent, path, alt, len, i, n;
+  int32_t  rc = 0;
+
+  cycles = 0U;
+  kept   = 0U;
+  sent   = 0U;
+  Cnt_Tx = 0U;
+
+  /* Changed and base configuration alternate, starting from base */
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, BASE_CFG);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 1U);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+  init0 = ENET_ModelStats.init;
+
+  for (i = 0U; i < count; i++) {
+    alt = (i & 1U) ^ 1U;
+    for (n = 0U; n < RX_WAIT; n++) {
+      (void)ENET_ModelRx (Frame, Generate (Frame, Seq++));
+    }
+
+    tx0 = ENET_ModelStats.tx_cycles;
+    t0  = Host_Cycles ();
+    (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, (alt != 0U) ? c->cfg : BASE_CFG);
+    cycles += (Host_Cycles () - t0) - (ENET_ModelStats.tx_cycles - tx0);
+
+    if (c->check (alt) == 0U) {
+      printf ("  %s: registers not %s\n", c->name, (alt != 0U) ? "changed" : "restored");
+      rc = 1;
+      break;
+    }
+
+    /* Network stack enables the MAC after configuration */
+    (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 1U);
+    (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+    while ((len = Mac->GetRxFrameSize ()) != 0U) {
+      Check (Frame, Mac->ReadFrame (Frame, (len <= sizeof(Frame)) ? len : 0U));
+      kept++;
+    }
+    Seq_Read = Seq;
+
+    Generate (Frame, i);
+    if (Mac->SendFrame (Frame, FRAME_LEN, 0U) == ARM_DRIVER_OK) {
+      sent++;
+    }
+    Host_Advance (10000U);
+  }
+
+  if (ENET_ModelStats.init != init0) {
+    path = PATH_INIT;
+  } else if (kept == 0U) {
+    path = PATH_RESTART;
+  } else {
+    path = PATH_FLY;
+  }
+
+  printf ("%-18s %-11s %10.0f %8u %6u/%-6u %6u/%u\n", c->name, PathName[path], (double)cycles / count,
+          (unsigned)(ENET_ModelStats.init - init0), (unsigned)kept, (unsigned)(count * RX_WAIT),
+          (unsigned)Cnt_Tx, (unsigned)count);
+
+  if ((rc == 0) && (path != c->path)) {
+    printf ("  expected path %s\n", PathName[c->path]);
+    rc = 1;
+  }
+  if ((rc == 0) && (kept != ((path == PATH_FLY) ? (count * RX_WAIT) : 0U))) {
+    printf ("  %u waiting frames lost on the fly\n", (unsigned)((count * RX_WAIT) - kept));
+    rc = 1;
+  }
+  if ((rc == 0) && ((sent != count) || (Cnt_Tx != count))) {
+    printf ("  %u frames not sent after reconfiguration\n", (unsigned)(count - Cnt_Tx));
+    rc = 1;
+  }
+  return (rc);
+}
+
+int main (int argc, char *argv[]) {
+  uint32_t count = (argc > 1) ? (uint32_t)strtoul (argv[1], NULL, 0) : 1000U;
+  int32_t  rc    = 0;
+  uint32_t i;
+
+  if ((count < 2U) || ((count & 1U) != 0U)) {
+    printf ("usage: emac_reconfig [count] (even, at least 2)\n");
+    return (2);
+  }
+
+  Host_Init (1U);
+  ENET_ModelTxHook (TxCount);
+
+  (void)Mac->Initialize (NULL);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  printf ("%u reconfigurations per case, %u frames waiting in the receive ring\n", (unsigned)count,
+          (unsigned)RX_WAIT);
+  printf ("%-18s %-11s %10s %8s %13s %13s\n", "change", "path", "cycles", "ENET_Init", "rx kept", "tx sent");
+  for (i = 0U; (i < (sizeof(Cases) / sizeof(Cases[0]))) && (rc == 0); i++) {
+    rc = Run (&Cases[i], count);
+  }
+  if ((rc == 0) && (Cnt_Bad != 0U)) {
+    printf ("%u frames corrupted or out of order\n", (unsigned)Cnt_Bad);
+    rc = 1;
+  }
+
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 0U);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 0U);
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  return (rc);
+}
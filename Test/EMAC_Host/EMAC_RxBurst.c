@@ -0,0 +1,271 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host receive ring drop rate under scripted burst patterns
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in virtual time (see ENET_Model.h)
+  and measures the receive drop rate of burst patterns on a 100 Mbit/s link
+  against the receive buffer memory. The receive ring depth is the build
+  option EMAC_RX_BUF_CNT, small frames are held in EMAC_RX_SLAB_CNT slabs of
+  EMAC_RX_SLAB_SIZE bytes. Build and run from the repository root, for example
+  for several ring depths and for a shallow ring with slabs:
+
+    for cfg in "-DEMAC_RX_BUF_CNT=16" "-DEMAC_RX_BUF_CNT=64"
+               "-DEMAC_RX_BUF_CNT=8 -DEMAC_RX_SLAB_CNT=64"; do
+      gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+          -ITest/EMAC_Host -ICMSIS/Driver $cfg Test/EMAC_Host/EMAC_RxBurst.c
+          Test/EMAC_Host/Host_Core.c Test/EMAC_Host/ENET_Model.c CMSIS/Driver/EMAC_iMXRT105x.c
+          -o emac_rx_burst && ./emac_rx_burst
+    done
+    ./emac_rx_burst [wake] [cost] [script [repeat]]
+
+  The application is modelled as a thread which is woken by the receive event
+  after wake us (default 100) and then reads frames with ReadFrame, cost ns
+  per frame (default 3000), until the ring is empty; the next receive event
+  wakes it again after wake us. A script is a comma separated list of
+  segments: "N*S" sends N frames of S bytes (without FCS) back to back at link
+  rate, "+U" keeps the link idle for U us. Without a script a set of built-in
+  patterns is run. The program returns 0 when every frame was either read
+  intact and in order or counted as dropped.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+#define LINK_NS_PER_BYTE  80U           /* 100 Mbit/s                                 */
+#define LINK_OVERHEAD     24U           /* FCS, preamble and inter-frame gap in bytes */
+#define NEVER             UINT64_MAX
+
+/* Driver defaults, for the report only */
+#ifndef EMAC_RX_BUF_CNT
+  #define EMAC_RX_BUF_CNT   4U
+#endif
+#ifndef EMAC_RX_LOAN_CNT
+  #define EMAC_RX_LOAN_CNT  0U
+#endif
+#ifndef EMAC_RX_SLAB_CNT
+  #define EMAC_RX_SLAB_CNT  0U
+#endif
+#ifndef EMAC_RX_SLAB_SIZE
+  #define EMAC_RX_SLAB_SIZE 128U
+#endif
+#ifndef EMAC_BUF_SIZE
+  #define EMAC_BUF_SIZE     1536U
+#endif
+
+/* Receive buffer memory: ring and spare buffers, slabs */
+#define RX_MEMORY         (((EMAC_RX_BUF_CNT + EMAC_RX_LOAN_CNT) * EMAC_BUF_SIZE) + \
+                           (EMAC_RX_SLAB_CNT * EMAC_RX_SLAB_SIZE))
+
+typedef struct {
+  const char *name;
+  const char *script;
+  uint32_t    repeat;
+} PATTERN;
+
+static const PATTERN Patterns[] = {
+  { "broadcast burst",   "64*64,+2000",         50U },
+  { "ARP storm",         "256*60,+10000",       10U },
+  { "bulk 1514",         "1000*1514",            1U },
+  { "mixed",             "16*64,8*1514,+200",  100U },
+  { "sparse",            "1*64,+50",          1000U }
+};
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+static uint8_t   Frame[1536];
+static uint32_t  Wake = 100U;
+static uint32_t  Cost = 3000U;
+static uint64_t  App_Next;              /* Time of next application read             */
+static uint32_t  Seq;                   /* Next frame sequence number to send        */
+static uint32_t  Seq_Read;              /* Next sequence number expected             */
+static uint32_t  Cnt_Read;
+static uint32_t  Cnt_Bad;
+
+static uint32_t Generate (uint8_t *frame, uint32_t seq, uint32_t len) {
+  uint32_t i;
+
+  memcpy (&frame[0], MacAddr, 6U);
+  memcpy (&frame[6], "\x02\x00\x00\x00\x00\x02", 6U);
+  frame[12] = 0x88U;
+  frame[13] = 0xB5U;
+  memcpy (&frame[14], &seq, 4U);
+  for (i = 18U; i < len; i++) {
+    frame[i] = (uint8_t)(seq + i);
+  }
+  return (len);
+}
+
+/* Received frames must be intact and in order, gaps are drops */
+static void Check (const uint8_t *frame, int32_t len) {
+  uint32_t seq, i;
+
+  if (len < 18) {
+    Cnt_Bad++;
+    return;
+  }
+  memcpy (&seq, &frame[14], 4U);
+  if (seq < Seq_Read) {
+    Cnt_Bad++;
+    return;
+  }
+  for (i = 18U; i < (uint32_t)len; i++) {
+    if (frame[i] != (uint8_t)(seq + i)) {
+      Cnt_Bad++;
+      return;
+    }
+  }
+  Seq_Read = seq + 1U;
+}
+
+/* Receive event (ENET interrupt): wake the application thread */
+static void MAC_Event (uint32_t event) {
+  if (((event & ARM_ETH_MAC_EVENT_RX_FRAME) != 0U) && (App_Next == NEVER)) {
+    App_Next = Host_Time () + ((uint64_t)Wake * 1000U);
+  }
+}
+
+/* Let time pass until t, the application reads frames when it is scheduled */
+static void RunUntil (uint64_t t) {
+  uint32_t len;
+  int32_t  rc;
+
+  while (App_Next <= t) {
+    Host_Advance (App_Next - Host_Time ());
+    len = Mac->GetRxFrameSize ();
+    if (len == 0U) {
+      App_Next = NEVER;
+      continue;
+    }
+    rc = Mac->ReadFrame (Frame, (len <= sizeof(Frame)) ? len : 0U);
+    Check (Frame, rc);
+    Cnt_Read++;
+    App_Next += Cost;
+  }
+  Host_Advance (t - Host_Time ());
+}
+
+static int32_t Run (const char *name, const char *script, uint32_t repeat) {
+  const char *p;
+  char       *end;
+  uint64_t    t, drop0;
+  uint32_t    seq0, sent, n, size, r, i;
+
+  seq0     = Seq;
+  drop0    = ENET_ModelStats.rx_drop;
+  Cnt_Read = 0U;
+  Seq_Read = Seq;
+
+  t = Host_Time ();
+  for (r = 0U; r < repeat; r++) {
+    p = script;
+    while (*p != '\0') {
+      if (*p == '+') {
+        t += strtoul (p + 1, &end, 10) * 1000U;
+        RunUntil (t);
+      } else {
+        n = (uint32_t)strtoul (p, &end, 10);
+        if (*end != '*') {
+          return (-1);
+        }
+        size = (uint32_t)strtoul (end + 1, &end, 10);
+        if ((size < 18U) || (size > 1514U)) {
+          return (-1);
+        }
+        for (i = 0U; i < n; i++) {
+          RunUntil (t);
+          (void)ENET_ModelRx (Frame, Generate (Frame, Seq++, size));
+          t += (uint64_t)(size + LINK_OVERHEAD) * LINK_NS_PER_BYTE;
+        }
+      }
+      if ((end == p) || ((*end != ',') && (*end != '\0'))) {
+        return (-1);
+      }
+      p = (*end == ',') ? (end + 1) : end;
+    }
+  }
+  /* Drain the ring */
+  RunUntil (t + 100000000U);
+
+  sent = Seq - seq0;
+  printf ("%-18s %8u %8u %8u %7.2f %%\n", name, (unsigned)sent, (unsigned)Cnt_Read,
+          (unsigned)(ENET_ModelStats.rx_drop - drop0),
+          (sent != 0U) ? (((ENET_ModelStats.rx_drop - drop0) * 100.0) / sent) : 0.0);
+
+  if ((Cnt_Read + (ENET_ModelStats.rx_drop - drop0)) != sent) {
+    printf ("  %u frames lost without drop count\n",
+            (unsigned)(sent - Cnt_Read - (ENET_ModelStats.rx_drop - drop0)));
+    return (1);
+  }
+  return (0);
+}
+
+int main (int argc, char *argv[]) {
+  int32_t  rc = 0;
+  uint32_t i;
+
+  if (argc > 1) { Wake = (uint32_t)strtoul (argv[1], NULL, 0); }
+  if (argc > 2) { Cost = (uint32_t)strtoul (argv[2], NULL, 0); }
+
+  Host_Init (1U);
+  App_Next = NEVER;
+
+  (void)Mac->Initialize (MAC_Event);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL |
+                                             ARM_ETH_MAC_ADDRESS_BROADCAST);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  printf ("EMAC_RX_BUF_CNT %u, EMAC_RX_SLAB_CNT %u, receive buffers %u bytes, wake %u us, read %u ns/frame\n",
+          (unsigned)EMAC_RX_BUF_CNT, (unsigned)EMAC_RX_SLAB_CNT, (unsigned)RX_MEMORY, (unsigned)Wake,
+          (unsigned)Cost);
+  printf ("%-18s %8s %8s %8s %9s\n", "pattern", "sent", "read", "dropped", "drop");
+  if (argc > 3) {
+    rc = Run (argv[3], argv[3], (argc > 4) ? (uint32_t)strtoul (argv[4], NULL, 0) : 1U);
+    if (rc < 0) {
+      printf ("invalid script: %s\n", argv[3]);
+      rc = 2;
+    }
+  } else {
+    for (i = 0U; (i < (sizeof(Patterns) / sizeof(Patterns[0]))) && (rc == 0); i++) {
+      rc = Run (Patterns[i].name, Patterns[i].script, Patterns[i].repeat);
+    }
+  }
+  if ((rc == 0) && (Cnt_Bad != 0U)) {
+    printf ("%u frames corrupted or out of order\n", (unsigned)Cnt_Bad);
+    rc = 1;
+  }
+
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  return (rc);
+}
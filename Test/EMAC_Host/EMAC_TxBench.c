@@ -0,0 +1,176 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host transmit benchmark: scatter-gather versus copy
+ * -------------------------------------------------------------------------- */
+
+/*
+  Runs EMAC_iMXRT105x.c on the ENET model in virtual time (see ENET_Model.h)
+  and measures the driver cost of transmitting fragmented frames: a header
+  fragment followed by payload fragments, sent with the
+  ARM_ETH_MAC_TX_FRAME_FRAGMENT flag like an IP stack does. Build the copy
+  path and the scatter-gather path and run both from the repository root:
+
+    for zc in 0 1; do
+      gcc -O2 -Wall -no-pie -pthread -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+          -ITest/EMAC_Host -ICMSIS/Driver -DEMAC_TX_BUF_CNT=8 -DEMAC_TX_ZERO_COPY=$zc
+          Test/EMAC_Host/EMAC_TxBench.c Test/EMAC_Host/Host_Core.c Test/EMAC_Host/ENET_Model.c
+          CMSIS/Driver/EMAC_iMXRT105x.c -o emac_tx_bench && ./emac_tx_bench
+    done
+    ./emac_tx_bench [size] [frags] [frames]
+
+  size is the frame length without FCS (60..1514, default 1514), frags the
+  number of fragments per frame (2..EMAC_TX_BUF_CNT, default 2: 54 byte
+  header and payload), frames the number of frames (default 200000).
+  Reported are frame bytes per driver cycle: host CPU time of SendFrame and of
+  the ENET interrupt handler scaled to SystemCoreClock, without the time of
+  the transmit DMA model. Cycle counts compare driver variants on the same
+  host, they do not predict Cortex-M7 timing. Every transmitted frame is
+  checked; the program returns 0 when all frames were sent intact and in
+  order.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ENET_Model.h"
+#include "EMAC_iMXRT105x.h"
+
+#define FRAME_MIN       60U
+#define FRAME_MAX       1514U
+#define HDR_LEN         54U             /* Ethernet, IPv4 and TCP header       */
+
+/* Driver defaults, for the report and header buffers only */
+#ifndef EMAC_TX_BUF_CNT
+  #define EMAC_TX_BUF_CNT     2U
+#endif
+#ifndef EMAC_TX_ZERO_COPY
+  #define EMAC_TX_ZERO_COPY   0
+#endif
+
+static const uint8_t MacAddr[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static ARM_DRIVER_ETH_MAC *Mac = &Driver_ETH_MAC0;
+
+/* Header fragments stay valid until sent: one per frame in transmission */
+static uint8_t  Hdr[EMAC_TX_BUF_CNT + 1U][HDR_LEN];
+static uint8_t  Payload[FRAME_MAX];
+static uint32_t Size = FRAME_MAX;
+static uint32_t Seq_Tx;                 /* Next sequence number expected on the wire */
+static uint32_t Cnt_Bad;
+
+static void Header (uint8_t *hdr, uint32_t seq) {
+  memset (hdr, 0, HDR_LEN);
+  memcpy (&hdr[0], "\x02\x00\x00\x00\x00\x02", 6U);
+  memcpy (&hdr[6], MacAddr, 6U);
+  hdr[12] = 0x88U;
+  hdr[13] = 0xB5U;
+  memcpy (&hdr[14], &seq, 4U);
+}
+
+/* Transmitted frames must be intact and in order */
+static void TxCheck (const uint8_t *frame, uint32_t len) {
+  uint32_t seq;
+
+  memcpy (&seq, &frame[14], 4U);
+  if ((len != Size) || (seq != Seq_Tx) ||
+      (memcmp (&frame[HDR_LEN], &Payload[HDR_LEN], Size - HDR_LEN) != 0)) {
+    Cnt_Bad++;
+  }
+  Seq_Tx = seq + 1U;
+}
+
+/* Send fragment, wait for a free descriptor */
+static void Send (const uint8_t *frag, uint32_t len, uint32_t flags, uint32_t *busy) {
+  while (Mac->SendFrame (frag, len, flags) == ARM_DRIVER_ERROR_BUSY) {
+    (*busy)++;
+    Host_Advance (1000U);
+  }
+}
+
+int main (int argc, char *argv[]) {
+  uint32_t frags  = (argc > 2) ? (uint32_t)strtoul (argv[2], NULL, 0) : 2U;
+  uint32_t frames = (argc > 3) ? (uint32_t)strtoul (argv[3], NULL, 0) : 200000U;
+  uint32_t seq, ofs, len, busy, i;
+  uint64_t t0, cycles;
+  uint8_t *hdr;
+
+  if (argc > 1) { Size = (uint32_t)strtoul (argv[1], NULL, 0); }
+  if ((Size < FRAME_MIN) || (Size > FRAME_MAX) || (frags < 2U) ||
+      ((EMAC_TX_ZERO_COPY != 0) && (frags > EMAC_TX_BUF_CNT)) || ((Size - HDR_LEN) < (frags - 1U))) {
+    printf ("usage: emac_tx_bench [size] [frags] [frames]\n");
+    return (2);
+  }
+  for (i = 0U; i < FRAME_MAX; i++) {
+    Payload[i] = (uint8_t)i;
+  }
+
+  Host_Init (1U);
+  ENET_ModelTxHook (TxCheck);
+
+  (void)Mac->Initialize (NULL);
+  (void)Mac->PowerControl (ARM_POWER_FULL);
+  (void)Mac->SetMacAddress ((const ARM_ETH_MAC_ADDR *)MacAddr);
+  (void)Mac->Control (ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL);
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 1U);
+
+  busy = 0U;
+  ENET_ModelStats.tx_cycles = 0U;
+  Host_Stats.irq_cycles     = 0U;
+  t0 = Host_Cycles ();
+  for (seq = 0U; seq < frames; seq++) {
+    hdr = Hdr[seq % (EMAC_TX_BUF_CNT + 1U)];
+    Header (hdr, seq);
+    Send (hdr, HDR_LEN, ARM_ETH_MAC_TX_FRAME_FRAGMENT, &busy);
+    /* Payload split into equal fragments, the last one takes the rest */
+    ofs = HDR_LEN;
+    for (i = 1U; i < frags; i++) {
+      len = (i < (frags - 1U)) ? ((Size - HDR_LEN) / (frags - 1U)) : (Size - ofs);
+      Send (&Payload[ofs], len, (i < (frags - 1U)) ? ARM_ETH_MAC_TX_FRAME_FRAGMENT : 0U, &busy);
+      ofs += len;
+    }
+  }
+  Host_Advance (1000000U);
+  cycles = (Host_Cycles () - t0) - ENET_ModelStats.tx_cycles;
+
+  printf ("%s, EMAC_TX_BUF_CNT %u, size %u, %u fragments, %u frames\n",
+          (EMAC_TX_ZERO_COPY != 0) ? "scatter-gather" : "copy", (unsigned)EMAC_TX_BUF_CNT,
+          (unsigned)Size, (unsigned)frags, (unsigned)frames);
+  printf ("  frames sent      %10llu  (busy %u)\n", (unsigned long long)ENET_ModelStats.tx_frames,
+          (unsigned)busy);
+  printf ("  cycles/frame     %10.0f  (interrupt %.0f)\n", (double)cycles / frames,
+          (double)Host_Stats.irq_cycles / frames);
+  printf ("  bytes/cycle      %10.2f\n", ((double)Size * frames) / (double)cycles);
+
+  (void)Mac->Control (ARM_ETH_MAC_CONTROL_TX, 0U);
+  (void)Mac->PowerControl (ARM_POWER_OFF);
+  (void)Mac->Uninitialize ();
+  Host_Exit ();
+
+  if ((ENET_ModelStats.tx_frames != frames) || (Cnt_Bad != 0U)) {
+    printf ("  %u frames lost, %u frames corrupted or out of order\n",
+            (unsigned)(frames - ENET_ModelStats.tx_frames), (unsigned)Cnt_Bad);
+    return (1);
+  }
+  return (0);
+}
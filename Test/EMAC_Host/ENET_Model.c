@@ -0,0 +1,905 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      ENET register and descriptor DMA model with SDK ENET API
+ * -------------------------------------------------------------------------- */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "ENET_Model.h"
+
+/* Reserved EIR bit kept set by the model, cleared when the driver writes EIR (write 1 to clear) */
+#define EIR_UNWRITTEN           0x00000001U
+
+/* Longest frame the transmit DMA assembles */
+#define TX_FRAME_MAX            4096U
+
+/* Wire thread idle tick in ns (coalescing timers and 1588 timer) */
+#define WIRE_TICK               1000000U
+
+#define NSEC_PER_SEC            1000000000U
+
+/* MIB counters: frame counters are 16-bit, octet counters 32-bit */
+#define MIB16(reg, n)   (*(volatile uint32_t *)&Enet.reg = (Enet.reg + (uint32_t)(n)) & 0xFFFFU)
+#define MIB32(reg, n)   (*(volatile uint32_t *)&Enet.reg =  Enet.reg + (uint32_t)(n))
+
+/* Interrupt coalescing state */
+typedef struct {
+  uint32_t cnt;                         /* Frames since last interrupt     */
+  uint64_t t0;                          /* Time of first coalesced frame   */
+} IC_STATE;
+
+ENET_MODEL_STATS ENET_ModelStats;
+
+/* ENET register block */
+static ENET_Type Enet;
+
+/* Model state not visible in registers */
+static struct {
+  enet_handle_t *handle;                /* SDK handle registered in ENET_Init    */
+  uint32_t       eir;                   /* Interrupt event register              */
+  uint32_t       ecr;                   /* ECR value seen at last sync           */
+  uint32_t       rxic;                  /* RXIC value seen at last sync          */
+  uint32_t       txic;                  /* TXIC value seen at last sync          */
+  uint32_t       gra;                   /* Graceful stop acknowledged            */
+  uint32_t       rx_idx;                /* Receive DMA descriptor index          */
+  uint32_t       tx_idx;                /* Transmit DMA descriptor index         */
+  IC_STATE       rx_ic;
+  IC_STATE       tx_ic;
+  uint32_t       ptp_on;                /* 1588 timer running                    */
+  int64_t        ptp_ofs;               /* 1588 time minus host time in ns       */
+  uint64_t       ptp_sec;               /* Seconds seen at last sync             */
+  uint32_t       ptp_ns;                /* Nanoseconds seen at last sync         */
+  uint16_t       phy[32];               /* PHY registers                         */
+  ENET_ModelTx_t tx_hook;
+} Model;
+
+static uint8_t Tx_Frame[TX_FRAME_MAX];
+
+/* Wire thread */
+static struct {
+  pthread_t       tid;
+  volatile uint32_t run;
+  uint32_t        rate;
+  uint32_t        count;
+  ENET_ModelGen_t gen;
+} Wire;
+
+static uint8_t Wire_Frame[2048];
+
+static volatile enet_rx_bd_struct_t *RxBd (uint32_t idx) {
+  return ((volatile enet_rx_bd_struct_t *)(uintptr_t)Enet.RDSR + idx);
+}
+
+static volatile enet_tx_bd_struct_t *TxBd (uint32_t idx) {
+  return ((volatile enet_tx_bd_struct_t *)(uintptr_t)Enet.TDSR + idx);
+}
+
+/* Coalescing timer threshold in ns: ICTT counts 64 cycles of the selected clock */
+static uint64_t IcTime (uint32_t ic) {
+  uint64_t clk = ((ic & ENET_RXIC_ICCS_MASK) != 0U) ? CLOCK_GetFreq (kCLOCK_IpgClk) : 25000000U;
+
+  return (((uint64_t)(ic & 0xFFFFU) * 64U * NSEC_PER_SEC) / clk);
+}
+
+/* Frame event: raise interrupt directly or through the coalescing counter */
+static void IcEvent (uint32_t ic, IC_STATE *st, uint32_t bit, uint64_t *cnt) {
+
+  if ((ic & ENET_RXIC_ICEN_MASK) == 0U) {
+    Model.eir |= bit;
+    (*cnt)++;
+    return;
+  }
+  if (st->cnt == 0U) {
+    st->t0 = Host_Time ();
+  }
+  st->cnt++;
+  if (st->cnt >= ((ic >> 20) & 0xFFU)) {
+    st->cnt = 0U;
+    Model.eir |= bit;
+    (*cnt)++;
+  }
+}
+
+static void IcTimer (uint32_t ic, IC_STATE *st, uint32_t bit, uint64_t *cnt) {
+
+  if (((ic & ENET_RXIC_ICEN_MASK) != 0U) && (st->cnt != 0U) && ((Host_Time () - st->t0) >= IcTime (ic))) {
+    st->cnt = 0U;
+    Model.eir |= bit;
+    (*cnt)++;
+  }
+}
+
+/* 1588 timer */
+static uint64_t PtpTime (void) {
+  return ((uint64_t)((int64_t)Host_Time () + Model.ptp_ofs));
+}
+
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+static uint32_t PtpNs (void) {
+  return ((Model.ptp_on != 0U) ? (uint32_t)(PtpTime () % NSEC_PER_SEC) : 0U);
+}
+#endif
+
+static void PtpUpdate (void) {
+  uint64_t t, sec;
+  uint32_t ns, cmp, ch, tcsr, hit;
+
+  if (Model.ptp_on == 0U) {
+    return;
+  }
+
+  t   = PtpTime ();
+  sec = t / NSEC_PER_SEC;
+  ns  = (uint32_t)(t % NSEC_PER_SEC);
+
+  /* Compare channels in software compare mode */
+  for (ch = 0U; ch < 4U; ch++) {
+    tcsr = Enet.CHANNEL[ch].TCSR;
+    if (((tcsr & ENET_TCSR_TMODE_MASK) != ENET_TCSR_TMODE(kENET_PtpChannelSoftCompare)) ||
+        ((tcsr & ENET_TCSR_TF_MASK) != 0U)) {
+      continue;
+    }
+    cmp = Enet.CHANNEL[ch].TCCR;
+    if (sec == Model.ptp_sec) {
+      hit = ((cmp > Model.ptp_ns) && (cmp <= ns)) ? 1U : 0U;
+    } else {
+      hit = ((cmp > Model.ptp_ns) || (cmp <= ns)) ? 1U : 0U;
+    }
+    if (hit != 0U) {
+      Enet.CHANNEL[ch].TCSR = tcsr | ENET_TCSR_TF_MASK;
+    }
+  }
+
+  if (sec != Model.ptp_sec) {
+    /* Seconds counter wrapped */
+    Model.eir |= ENET_EIR_TS_TIMER_MASK;
+  }
+  Model.ptp_sec = sec;
+  Model.ptp_ns  = ns;
+  Enet.ATVR     = ns;
+}
+
+/* Transmit DMA: send all frames with complete descriptor chains */
+static void TxProcess (void) {
+  volatile enet_tx_bd_struct_t *bd;
+  uint64_t t0 = Host_Cycles ();
+  uint32_t idx, cnt, len, last, ctrl, i;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+  uint32_t ns, ts;
+#endif
+
+  for (;;) {
+    idx  = Model.tx_idx;
+    cnt  = 0U;
+    len  = 0U;
+    last = 0U;
+    do {
+      bd   = TxBd (idx);
+      ctrl = bd->control;
+      if ((ctrl & ENET_BUFFDESCRIPTOR_TX_READY_MASK) == 0U) {
+        break;
+      }
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+      if ((len + bd->length) <= TX_FRAME_MAX) {
+        memcpy (&Tx_Frame[len], (const void *)(uintptr_t)bd->buffer, bd->length);
+      }
+      len += bd->length;
+      cnt++;
+      idx  = ((ctrl & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK) != 0U) ? 0U : (idx + 1U);
+      last = ctrl & ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
+    } while ((last == 0U) && (idx != Model.tx_idx));
+
+    if (last == 0U) {
+      if (cnt == 0U) {
+        /* No descriptor ready, transmit DMA idle */
+        Enet.TDAR = 0U;
+      }
+      /* Otherwise wait for the remaining fragments */
+      ENET_ModelStats.tx_cycles += Host_Cycles () - t0;
+      return;
+    }
+
+    /* Frame sent: stamp and return descriptors */
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    ns  = PtpNs ();
+    ts  = 0U;
+#endif
+    idx = Model.tx_idx;
+    for (i = 0U; i < cnt; i++) {
+      bd = TxBd (idx);
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+      ts |= bd->controlExtend1 & ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
+      bd->timestamp = ns;
+#endif
+      ctrl = bd->control;
+      __atomic_thread_fence (__ATOMIC_RELEASE);
+      bd->control = (uint16_t)(ctrl & ~ENET_BUFFDESCRIPTOR_TX_READY_MASK);
+      idx = ((ctrl & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK) != 0U) ? 0U : (idx + 1U);
+    }
+    Model.tx_idx = idx;
+
+    MIB16 (RMON_T_PACKETS,  1U);
+    MIB32 (RMON_T_OCTETS,   len + ENET_FCS_LEN);
+    MIB16 (IEEE_T_FRAME_OK, 1U);
+    MIB32 (IEEE_T_OCTETS_OK, len);
+    if ((len >= 6U) && ((Tx_Frame[0] & 0x01U) != 0U)) {
+      if (memcmp (Tx_Frame, "\xFF\xFF\xFF\xFF\xFF\xFF", 6U) == 0) {
+        MIB16 (RMON_T_BC_PKT, 1U);
+      } else {
+        MIB16 (RMON_T_MC_PKT, 1U);
+      }
+    }
+    ENET_ModelStats.tx_frames++;
+    ENET_ModelStats.tx_bytes += len;
+    if (Model.tx_hook != NULL) {
+      Model.tx_hook (Tx_Frame, (len < TX_FRAME_MAX) ? len : TX_FRAME_MAX);
+    }
+
+    IcEvent (Model.txic, &Model.tx_ic, ENET_EIR_TXF_MASK, &ENET_ModelStats.tx_irq);
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    if (ts != 0U) {
+      Model.eir |= ENET_EIR_TS_AVAIL_MASK;
+    }
+#endif
+  }
+}
+
+/**
+  \fn          void ENET_ModelSync (void)
+  \brief       Apply register writes done since the last register access and advance model timers.
+  \note        Called on every register access through the ENET macro, with the host CPU held.
+*/
+void ENET_ModelSync (void) {
+  uint32_t val;
+
+  /* Interrupt event register is write 1 to clear */
+  val = Enet.EIR;
+  if ((val & EIR_UNWRITTEN) == 0U) {
+    Model.eir &= ~val;
+  }
+
+  /* Clearing ETHEREN stops the DMA and resets the descriptor pointers */
+  val = Enet.ECR;
+  if (((Model.ecr & ENET_ECR_ETHEREN_MASK) != 0U) && ((val & ENET_ECR_ETHEREN_MASK) == 0U)) {
+    Model.rx_idx     = 0U;
+    Model.tx_idx     = 0U;
+    Model.rx_ic.cnt  = 0U;
+    Model.tx_ic.cnt  = 0U;
+    Enet.RDAR        = 0U;
+    Enet.TDAR        = 0U;
+  }
+  Model.ecr = val;
+
+  /* Writing a coalescing register restarts its frame counter and timer */
+  if (Enet.RXIC[0] != Model.rxic) {
+    Model.rxic      = Enet.RXIC[0];
+    Model.rx_ic.cnt = 0U;
+  }
+  if (Enet.TXIC[0] != Model.txic) {
+    Model.txic      = Enet.TXIC[0];
+    Model.tx_ic.cnt = 0U;
+  }
+
+  /* Graceful transmit stop completes immediately, frames are sent when TDAR is seen */
+  if ((Enet.TCR & ENET_TCR_GTS_MASK) != 0U) {
+    if (Model.gra == 0U) {
+      Model.gra  = 1U;
+      Model.eir |= ENET_EIR_GRA_MASK;
+    }
+  } else {
+    Model.gra = 0U;
+    if (((Model.ecr & ENET_ECR_ETHEREN_MASK) != 0U) && ((Enet.TDAR & ENET_TDAR_TDAR_MASK) != 0U)) {
+      TxProcess ();
+    }
+  }
+
+  IcTimer (Model.rxic, &Model.rx_ic, ENET_EIR_RXF_MASK, &ENET_ModelStats.rx_irq);
+  IcTimer (Model.txic, &Model.tx_ic, ENET_EIR_TXF_MASK, &ENET_ModelStats.tx_irq);
+  PtpUpdate ();
+
+  Enet.EIR = Model.eir | EIR_UNWRITTEN;
+
+  if ((ENET_ModelIrqPending (ENET_IRQn) != 0U) || (ENET_ModelIrqPending (ENET_1588_Timer_IRQn) != 0U)) {
+    Host_IrqWake ();
+  }
+}
+
+/**
+  \fn          ENET_Type *ENET_ModelAccess (void)
+  \brief       Get ENET register block for a register access by the driver.
+*/
+ENET_Type *ENET_ModelAccess (void) {
+  ENET_ModelSync ();
+  return (&Enet);
+}
+
+/**
+  \fn          uint32_t ENET_ModelIrqPending (IRQn_Type irq)
+  \brief       Check if the ENET requests an interrupt (NVIC enable not included).
+*/
+uint32_t ENET_ModelIrqPending (IRQn_Type irq) {
+  uint32_t ch;
+
+  if (irq == ENET_IRQn) {
+    return (((Model.eir & Enet.EIMR) != 0U) ? 1U : 0U);
+  }
+  for (ch = 0U; ch < 4U; ch++) {
+    if ((Enet.CHANNEL[ch].TCSR & (ENET_TCSR_TF_MASK | ENET_TCSR_TIE_MASK)) ==
+                                 (ENET_TCSR_TF_MASK | ENET_TCSR_TIE_MASK)) {
+      return (1U);
+    }
+  }
+  return (0U);
+}
+
+/**
+  \fn          uint64_t ENET_ModelDeadline (void)
+  \brief       Get the time of the next model timer event (coalescing timers, 1588 timer).
+  \return      time in ns, UINT64_MAX when no timer is running
+*/
+uint64_t ENET_ModelDeadline (void) {
+  uint64_t t, sec, dl = UINT64_MAX;
+  uint32_t ch, tcsr, cmp;
+
+  if (((Model.rxic & ENET_RXIC_ICEN_MASK) != 0U) && (Model.rx_ic.cnt != 0U)) {
+    t = Model.rx_ic.t0 + IcTime (Model.rxic);
+    dl = (t < dl) ? t : dl;
+  }
+  if (((Model.txic & ENET_TXIC_ICEN_MASK) != 0U) && (Model.tx_ic.cnt != 0U)) {
+    t = Model.tx_ic.t0 + IcTime (Model.txic);
+    dl = (t < dl) ? t : dl;
+  }
+  if (Model.ptp_on != 0U) {
+    /* Next second, or the next compare value within the current second */
+    t   = PtpTime ();
+    sec = t - (t % NSEC_PER_SEC);
+    for (ch = 0U; ch < 4U; ch++) {
+      tcsr = Enet.CHANNEL[ch].TCSR;
+      cmp  = Enet.CHANNEL[ch].TCCR;
+      if (((tcsr & ENET_TCSR_TMODE_MASK) == ENET_TCSR_TMODE(kENET_PtpChannelSoftCompare)) &&
+          ((tcsr & ENET_TCSR_TF_MASK) == 0U) && (cmp > (t - sec)) && (cmp < NSEC_PER_SEC)) {
+        sec = (sec + cmp) - NSEC_PER_SEC;
+        break;
+      }
+    }
+    t  = (uint64_t)((int64_t)(sec + NSEC_PER_SEC) - Model.ptp_ofs);
+    dl = (t < dl) ? t : dl;
+  }
+  return (dl);
+}
+
+/**
+  \fn          void ENET_ModelReset (void)
+  \brief       Reset the ENET model, statistics and PHY registers.
+*/
+void ENET_ModelReset (void) {
+
+  memset (&Enet,  0, sizeof(Enet));
+  memset (&Model, 0, sizeof(Model));
+  memset (&ENET_ModelStats, 0, sizeof(ENET_ModelStats));
+
+  /* PHY: link up, 100M full duplex, autonegotiation complete */
+  Model.phy[0]  = 0x3100U;
+  Model.phy[1]  = 0x782DU;
+  Model.phy[2]  = 0x0022U;
+  Model.phy[3]  = 0x1561U;
+  Model.phy[5]  = 0x85E1U;
+  Model.phy[31] = 0x8118U;
+
+  Enet.EIR = EIR_UNWRITTEN;
+}
+
+/**
+  \fn          void ENET_ModelPhySet (uint32_t reg, uint16_t val)
+  \brief       Set PHY register value returned by MDIO reads.
+*/
+void ENET_ModelPhySet (uint32_t reg, uint16_t val) {
+  Model.phy[reg & 0x1FU] = val;
+}
+
+/**
+  \fn          void ENET_ModelTxHook (ENET_ModelTx_t hook)
+  \brief       Register function called for every transmitted frame.
+*/
+void ENET_ModelTxHook (ENET_ModelTx_t hook) {
+  Model.tx_hook = hook;
+}
+
+/**
+  \fn          uint32_t ENET_ModelRx (const uint8_t *frame, uint32_t len)
+  \brief       Receive frame from the wire (without FCS).
+  \return      1 = frame written to receive descriptor, 0 = frame dropped
+  \note        Called with the host CPU held, not from driver code.
+*/
+uint32_t ENET_ModelRx (const uint8_t *frame, uint32_t len) {
+  volatile enet_rx_bd_struct_t *bd;
+  uint32_t ofs, max, ctrl, bc, mc, stored;
+
+  ENET_ModelSync ();
+
+  ENET_ModelStats.rx_frames++;
+  bc = ((len >= 6U) && (memcmp (frame, "\xFF\xFF\xFF\xFF\xFF\xFF", 6U) == 0)) ? 1U : 0U;
+  mc = ((bc == 0U) && (len != 0U) && ((frame[0] & 0x01U) != 0U)) ? 1U : 0U;
+  MIB16 (RMON_R_PACKETS, 1U);
+  MIB32 (RMON_R_OCTETS,  len + ENET_FCS_LEN);
+  if (bc != 0U) { MIB16 (RMON_R_BC_PKT, 1U); }
+  if (mc != 0U) { MIB16 (RMON_R_MC_PKT, 1U); }
+
+  stored = 0U;
+  if (((Model.ecr & ENET_ECR_ETHEREN_MASK) != 0U) && ((Enet.RDAR & ENET_RDAR_RDAR_MASK) != 0U)) {
+    bd   = RxBd (Model.rx_idx);
+    ctrl = bd->control;
+    if ((ctrl & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) != 0U) {
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+      ofs = ((Enet.RACC & kENET_RxAccelisShift16Enabled) != 0U) ? 2U : 0U;
+      max = Enet.MRBR - ofs;
+      ctrl &= ENET_BUFFDESCRIPTOR_RX_WRAP_MASK;
+      if (len > max) {
+        /* Receive buffer chaining is not modelled */
+        len   = max;
+        ctrl |= ENET_BUFFDESCRIPTOR_RX_TRUNC_MASK;
+      }
+      memcpy ((uint8_t *)(uintptr_t)bd->buffer + ofs, frame, len);
+      bd->length = (uint16_t)(len + ofs);
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+      bd->controlExtend0 = 0U;
+      bd->controlExtend1 = ENET_BUFFDESCRIPTOR_RX_INTERRUPT_MASK;
+      bd->timestamp      = PtpNs ();
+#endif
+      ctrl |= ENET_BUFFDESCRIPTOR_RX_LAST_MASK;
+      if (bc != 0U) { ctrl |= ENET_BUFFDESCRIPTOR_RX_BROADCAST_MASK; }
+      if (mc != 0U) { ctrl |= ENET_BUFFDESCRIPTOR_RX_MULTICAST_MASK; }
+      __atomic_thread_fence (__ATOMIC_RELEASE);
+      bd->control = (uint16_t)ctrl;
+
+      Model.rx_idx = ((ctrl & ENET_BUFFDESCRIPTOR_RX_WRAP_MASK) != 0U) ? 0U : (Model.rx_idx + 1U);
+      MIB16 (IEEE_R_FRAME_OK,  1U);
+      MIB32 (IEEE_R_OCTETS_OK, len);
+      ENET_ModelStats.rx_stored++;
+      IcEvent (Model.rxic, &Model.rx_ic, ENET_EIR_RXF_MASK, &ENET_ModelStats.rx_irq);
+      stored = 1U;
+    } else {
+      /* No empty descriptor: receive DMA stops until RDAR is written */
+      Enet.RDAR = 0U;
+    }
+  }
+  if (stored == 0U) {
+    ENET_ModelStats.rx_drop++;
+    MIB16 (IEEE_R_MACERR, 1U);
+  }
+
+  ENET_ModelSync ();
+  Host_IrqRun ();
+
+  return (stored);
+}
+
+/* Wire thread: inject frames at a fixed rate, tick model timers when idle */
+static void *WireThread (void *arg) {
+  uint64_t next, now, period, dl;
+  uint32_t seq, len;
+  struct timespec ts;
+
+  (void)arg;
+
+  period = (Wire.rate != 0U) ? (NSEC_PER_SEC / Wire.rate) : 0U;
+  seq    = 0U;
+  next   = Host_Time ();
+  dl     = next + WIRE_TICK;
+
+  while (Wire.run != 0U) {
+    now = Host_Time ();
+    if ((period != 0U) && ((Wire.count == 0U) || (seq < Wire.count)) && (now >= next)) {
+      Host_CpuLock ();
+      /* Frames arrive at their time, the wire does not wait for the CPU */
+      while ((now >= next) && ((Wire.count == 0U) || (seq < Wire.count))) {
+        len = Wire.gen (Wire_Frame, seq++);
+        (void)ENET_ModelRx (Wire_Frame, len);
+        next += period;
+      }
+      dl = ENET_ModelDeadline ();
+      Host_CpuUnlock ();
+      continue;
+    }
+    if (now >= dl) {
+      Host_CpuLock ();
+      ENET_ModelSync ();
+      dl = ENET_ModelDeadline ();
+      Host_CpuUnlock ();
+      if ((dl - now) > WIRE_TICK) {
+        dl = now + WIRE_TICK;
+      }
+      continue;
+    }
+    if ((period != 0U) && ((Wire.count == 0U) || (seq < Wire.count)) && (next < dl)) {
+      dl = next;
+    }
+    ts.tv_sec  = (time_t)((dl - now) / NSEC_PER_SEC);
+    ts.tv_nsec = (long)((dl - now) % NSEC_PER_SEC);
+    nanosleep (&ts, NULL);
+  }
+  return (NULL);
+}
+
+/**
+  \fn          void ENET_ModelWireStart (uint32_t rate, ENET_ModelGen_t gen, uint32_t count)
+  \brief       Start wire thread (real time only).
+  \param[in]   rate   Frames per second (0 = only tick model timers)
+  \param[in]   gen    Frame generator
+  \param[in]   count  Number of frames (0 = until stopped)
+*/
+void ENET_ModelWireStart (uint32_t rate, ENET_ModelGen_t gen, uint32_t count) {
+
+  Wire.rate  = rate;
+  Wire.gen   = gen;
+  Wire.count = count;
+  Wire.run   = 1U;
+  (void)pthread_create (&Wire.tid, NULL, WireThread, NULL);
+}
+
+/**
+  \fn          void ENET_ModelWireStop (void)
+  \brief       Stop wire thread.
+  \note        Called with the host CPU held.
+*/
+void ENET_ModelWireStop (void) {
+
+  if (Wire.run != 0U) {
+    Wire.run = 0U;
+    Host_CpuUnlock ();
+    (void)pthread_join (Wire.tid, NULL);
+    Host_CpuLock ();
+  }
+}
+
+
+/* SDK ENET driver API on the model */
+
+status_t ENET_Init (ENET_Type *base, enet_handle_t *handle, const enet_config_t *config,
+                    const enet_buffer_config_t *bufferConfig, uint8_t *macAddr, uint32_t srcClock_Hz) {
+  volatile enet_rx_bd_struct_t *rx_bd;
+  volatile enet_tx_bd_struct_t *tx_bd;
+  uint32_t i, rcr;
+
+  (void)base;
+  (void)srcClock_Hz;
+
+  ENET_ModelStats.init++;
+
+  /* Peripheral reset: registers, MIB counters and 1588 timer */
+  memset (&Enet, 0, sizeof(Enet));
+  Model.eir       = 0U;
+  Model.ecr       = 0U;
+  Model.rxic      = 0U;
+  Model.txic      = 0U;
+  Model.gra       = 0U;
+  Model.rx_idx    = 0U;
+  Model.tx_idx    = 0U;
+  Model.rx_ic.cnt = 0U;
+  Model.tx_ic.cnt = 0U;
+  Model.ptp_on    = 0U;
+
+  /* Buffer descriptors */
+  rx_bd = bufferConfig->rxBdStartAddrAlign;
+  for (i = 0U; i < bufferConfig->rxBdNumber; i++) {
+    rx_bd[i].buffer  = (uint32_t)(uintptr_t)(bufferConfig->rxBufferAlign + (i * bufferConfig->rxBuffSizeAlign));
+    rx_bd[i].length  = 0U;
+    rx_bd[i].control = ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    rx_bd[i].controlExtend1 = ENET_BUFFDESCRIPTOR_RX_INTERRUPT_MASK;
+#endif
+  }
+  rx_bd[bufferConfig->rxBdNumber - 1U].control |= ENET_BUFFDESCRIPTOR_RX_WRAP_MASK;
+
+  tx_bd = bufferConfig->txBdStartAddrAlign;
+  for (i = 0U; i < bufferConfig->txBdNumber; i++) {
+    if (bufferConfig->txBufferAlign != NULL) {
+      tx_bd[i].buffer = (uint32_t)(uintptr_t)(bufferConfig->txBufferAlign + (i * bufferConfig->txBuffSizeAlign));
+    } else {
+      tx_bd[i].buffer = 0U;
+    }
+    tx_bd[i].length  = 0U;
+    tx_bd[i].control = 0U;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    tx_bd[i].controlExtend1 = ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK;
+#endif
+  }
+  tx_bd[bufferConfig->txBdNumber - 1U].control |= ENET_BUFFDESCRIPTOR_TX_WRAP_MASK;
+
+  memset (handle, 0, sizeof(*handle));
+  handle->rxBdRing[0].rxBdBase  = rx_bd;
+  handle->rxBdRing[0].rxRingLen = bufferConfig->rxBdNumber;
+  handle->txBdRing[0].txBdBase  = tx_bd;
+  handle->txBdRing[0].txRingLen = bufferConfig->txBdNumber;
+  handle->rxBuffSizeAlign[0]    = bufferConfig->rxBuffSizeAlign;
+  handle->txBuffSizeAlign[0]    = bufferConfig->txBuffSizeAlign;
+  handle->callback              = config->callback;
+  handle->userData              = config->userData;
+  Model.handle = handle;
+
+  /* MAC configuration (CRC is stripped from received frames) */
+  rcr = ENET_RCR_MAX_FL(config->rxMaxFrameLen) | ENET_RCR_CRCFWD_MASK | ENET_RCR_MII_MODE_MASK;
+  if (config->miiMode == kENET_RmiiMode)  { rcr |= ENET_RCR_RMII_MODE_MASK; }
+  if (config->miiSpeed == kENET_MiiSpeed10M) { rcr |= ENET_RCR_RMII_10T_MASK; }
+  if (config->miiDuplex == kENET_MiiHalfDuplex) { rcr |= ENET_RCR_DRT_MASK; }
+  if ((config->macSpecialConfig & kENET_ControlPromiscuousEnable) != 0U) { rcr |= ENET_RCR_PROM_MASK; }
+  if ((config->macSpecialConfig & kENET_ControlRxBroadCastRejectEnable) != 0U) { rcr |= ENET_RCR_BC_REJ_MASK; }
+  if ((config->macSpecialConfig & kENET_ControlMIILoopEnable) != 0U) {
+    rcr = (rcr | ENET_RCR_LOOP_MASK) & ~ENET_RCR_DRT_MASK;
+  }
+  Enet.RCR  = rcr;
+  Enet.TCR  = (config->miiDuplex == kENET_MiiFullDuplex) ? ENET_TCR_FDEN_MASK : 0U;
+  Enet.RACC = config->rxAccelerConfig;
+  Enet.TACC = config->txAccelerConfig;
+  Enet.TFWR = config->txFifoWatermark;
+  Enet.OPD  = config->pauseDuration;
+  Enet.RDSR = (uint32_t)(uintptr_t)rx_bd;
+  Enet.TDSR = (uint32_t)(uintptr_t)tx_bd;
+  Enet.MRBR = bufferConfig->rxBuffSizeAlign;
+  Enet.EIMR = config->interrupt;
+  if (config->intCoalesceCfg != NULL) {
+    Enet.RXIC[0] = ENET_RXIC_ICEN_MASK | ENET_RXIC_ICFT(config->intCoalesceCfg->rxCoalesceFrameCount[0]) |
+                   ENET_RXIC_ICTT(config->intCoalesceCfg->rxCoalesceTimeCount[0]);
+    Enet.TXIC[0] = ENET_TXIC_ICEN_MASK | ENET_TXIC_ICFT(config->intCoalesceCfg->txCoalesceFrameCount[0]) |
+                   ENET_TXIC_ICTT(config->intCoalesceCfg->txCoalesceTimeCount[0]);
+  }
+  ENET_SetMacAddr (&Enet, macAddr);
+
+  Enet.MIBC = 0U;
+  Enet.ECR  = ENET_ECR_ETHEREN_MASK | ENET_ECR_DBSWP_MASK;
+  Enet.EIR  = EIR_UNWRITTEN;
+  Model.ecr = Enet.ECR;
+
+  return (kStatus_Success);
+}
+
+void ENET_Deinit (ENET_Type *base) {
+  (void)base;
+
+  Enet.EIMR = 0U;
+  Enet.ECR  = 0U;
+  Model.eir = 0U;
+  ENET_ModelSync ();
+}
+
+void ENET_SetMacAddr (ENET_Type *base, uint8_t *macAddr) {
+  (void)base;
+
+  Enet.PALR = ((uint32_t)macAddr[0] << 24) | ((uint32_t)macAddr[1] << 16) | ((uint32_t)macAddr[2] << 8) | macAddr[3];
+  Enet.PAUR = ((uint32_t)macAddr[4] << 24) | ((uint32_t)macAddr[5] << 16) | 0x8808U;
+}
+
+void ENET_GetMacAddr (ENET_Type *base, uint8_t *macAddr) {
+  (void)base;
+
+  macAddr[0] = (uint8_t)(Enet.PALR >> 24);
+  macAddr[1] = (uint8_t)(Enet.PALR >> 16);
+  macAddr[2] = (uint8_t)(Enet.PALR >>  8);
+  macAddr[3] = (uint8_t)(Enet.PALR);
+  macAddr[4] = (uint8_t)(Enet.PAUR >> 24);
+  macAddr[5] = (uint8_t)(Enet.PAUR >> 16);
+}
+
+void ENET_AddMulticastGroup (ENET_Type *base, uint8_t *address) {
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t i, j;
+
+  (void)base;
+
+  for (i = 0U; i < 6U; i++) {
+    crc ^= address[i];
+    for (j = 0U; j < 8U; j++) {
+      crc = ((crc & 1U) != 0U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+    }
+  }
+  crc >>= 26;
+  if ((crc & 0x20U) != 0U) {
+    Enet.GAUR |= 1UL << (crc & 0x1FU);
+  } else {
+    Enet.GALR |= 1UL << (crc & 0x1FU);
+  }
+}
+
+void ENET_ActiveRead (ENET_Type *base) {
+  (void)base;
+
+  Enet.RDAR = ENET_RDAR_RDAR_MASK;
+}
+
+void ENET_EnableSleepMode (ENET_Type *base, bool enable) {
+  (void)base;
+
+  if (enable) {
+    Enet.ECR |= ENET_ECR_SLEEP_MASK | ENET_ECR_MAGICEN_MASK;
+  } else {
+    Enet.ECR &= ~(ENET_ECR_SLEEP_MASK | ENET_ECR_MAGICEN_MASK);
+  }
+}
+
+uint32_t ENET_GetInterruptStatus (ENET_Type *base) {
+  (void)base;
+
+  ENET_ModelSync ();
+  return (Model.eir);
+}
+
+void ENET_ClearInterruptStatus (ENET_Type *base, uint32_t mask) {
+  (void)base;
+
+  ENET_ModelSync ();
+  Model.eir &= ~mask;
+  Enet.EIR   = Model.eir | EIR_UNWRITTEN;
+}
+
+/* MDIO transactions complete immediately */
+void ENET_StartSMIRead (ENET_Type *base, uint32_t phyAddr, uint32_t phyReg, enet_mii_read_t operation) {
+  (void)base;
+
+  Enet.MMFR  = ((uint32_t)operation << ENET_MMFR_OP_SHIFT) | (phyAddr << ENET_MMFR_PA_SHIFT) |
+               (phyReg << ENET_MMFR_RA_SHIFT) | Model.phy[phyReg & 0x1FU];
+  Model.eir |= ENET_EIR_MII_MASK;
+  ENET_ModelSync ();
+}
+
+void ENET_StartSMIWrite (ENET_Type *base, uint32_t phyAddr, uint32_t phyReg, enet_mii_write_t operation,
+                         uint32_t data) {
+  (void)base;
+
+  Enet.MMFR = ((uint32_t)operation << ENET_MMFR_OP_SHIFT) | (phyAddr << ENET_MMFR_PA_SHIFT) |
+              (phyReg << ENET_MMFR_RA_SHIFT) | (data & ENET_MMFR_DATA_MASK);
+  Model.phy[phyReg & 0x1FU] = (uint16_t)data;
+  Model.eir |= ENET_EIR_MII_MASK;
+  ENET_ModelSync ();
+}
+
+uint32_t ENET_ReadSMIData (ENET_Type *base) {
+  (void)base;
+
+  return (Enet.MMFR & ENET_MMFR_DATA_MASK);
+}
+
+/* 1588 timer: runs at nominal rate, ATINC/ATCOR corrections are not modelled */
+void ENET_Ptp1588Configure (ENET_Type *base, enet_handle_t *handle, enet_ptp_config_t *ptpConfig) {
+  (void)base;
+  (void)handle;
+
+  Enet.ATINC    = ENET_ATINC_INC(NSEC_PER_SEC / ptpConfig->ptp1588ClockSrc_Hz);
+  Enet.ATPER    = NSEC_PER_SEC;
+  Enet.ATCR     = ENET_ATCR_EN_MASK;
+  Enet.ECR     |= ENET_ECR_EN1588_MASK;
+  Enet.EIMR    |= ENET_EIR_TS_TIMER_MASK | ENET_EIR_TS_AVAIL_MASK;
+  Model.ptp_on  = 1U;
+  Model.ptp_ofs = -(int64_t)Host_Time ();
+  Model.ptp_sec = 0U;
+  Model.ptp_ns  = 0U;
+  ENET_ModelSync ();
+
+  /* Like the SDK, enable the 1588 timer interrupt */
+  NVIC_EnableIRQ (ENET_1588_Timer_IRQn);
+}
+
+void ENET_Ptp1588GetTimer (ENET_Type *base, enet_handle_t *handle, enet_ptp_time_t *ptpTime) {
+  uint64_t t = PtpTime ();
+
+  (void)base;
+  (void)handle;
+
+  ptpTime->second     = t / NSEC_PER_SEC;
+  ptpTime->nanosecond = (uint32_t)(t % NSEC_PER_SEC);
+}
+
+void ENET_Ptp1588SetTimer (ENET_Type *base, enet_handle_t *handle, enet_ptp_time_t *ptpTime) {
+  (void)base;
+  (void)handle;
+
+  Model.ptp_ofs = (int64_t)((ptpTime->second * NSEC_PER_SEC) + ptpTime->nanosecond) - (int64_t)Host_Time ();
+  Model.ptp_sec = ptpTime->second;
+  Model.ptp_ns  = ptpTime->nanosecond;
+}
+
+void ENET_Ptp1588SetChannelMode (ENET_Type *base, enet_ptp_timer_channel_t channel,
+                                 enet_ptp_timer_channel_mode_t mode, bool intEnable) {
+  (void)base;
+
+  Enet.CHANNEL[channel].TCSR = 0U;
+  Enet.CHANNEL[channel].TCSR = ENET_TCSR_TMODE(mode) | (intEnable ? ENET_TCSR_TIE_MASK : 0U);
+}
+
+void ENET_Ptp1588SetChannelCmpValue (ENET_Type *base, enet_ptp_timer_channel_t channel, uint32_t cmpValue) {
+  (void)base;
+
+  Enet.CHANNEL[channel].TCCR = cmpValue;
+}
+
+void ENET_Ptp1588ClearChannelStatus (ENET_Type *base, enet_ptp_timer_channel_t channel) {
+  (void)base;
+
+  Enet.CHANNEL[channel].TCSR &= ~ENET_TCSR_TF_MASK;
+}
+
+bool ENET_Ptp1588GetChannelStatus (ENET_Type *base, enet_ptp_timer_channel_t channel) {
+  (void)base;
+
+  ENET_ModelSync ();
+  return ((Enet.CHANNEL[channel].TCSR & ENET_TCSR_TF_MASK) != 0U);
+}
+
+/* SDK interrupt handlers: clear events and call the handle callback */
+static void Callback (enet_event_t event) {
+  enet_handle_t *h = Model.handle;
+
+  if ((h != NULL) && (h->callback != NULL)) {
+    h->callback (&Enet, h, event, NULL, h->userData);
+  }
+}
+
+static void TimeStampIRQ (void) {
+
+  if ((Model.eir & Enet.EIMR & ENET_EIR_TS_TIMER_MASK) != 0U) {
+    ENET_ClearInterruptStatus (&Enet, ENET_EIR_TS_TIMER_MASK);
+    Callback (kENET_TimeStampEvent);
+  }
+  if ((Model.eir & Enet.EIMR & ENET_EIR_TS_AVAIL_MASK) != 0U) {
+    ENET_ClearInterruptStatus (&Enet, ENET_EIR_TS_AVAIL_MASK);
+    Callback (kENET_TimeStampAvailEvent);
+  }
+}
+
+void ENET_DriverIRQHandler (void) {
+  uint32_t ev;
+
+  ENET_ModelSync ();
+  ev = Model.eir & Enet.EIMR;
+
+  if ((ev & (ENET_EIR_TXF_MASK | ENET_EIR_TXB_MASK)) != 0U) {
+    ENET_ClearInterruptStatus (&Enet, ENET_EIR_TXF_MASK | ENET_EIR_TXB_MASK);
+    Callback (kENET_TxEvent);
+  }
+  if ((ev & (ENET_EIR_RXF_MASK | ENET_EIR_RXB_MASK)) != 0U) {
+    ENET_ClearInterruptStatus (&Enet, ENET_EIR_RXF_MASK | ENET_EIR_RXB_MASK);
+    Callback (kENET_RxEvent);
+  }
+  if ((ev & (ENET_EIR_TS_TIMER_MASK | ENET_EIR_TS_AVAIL_MASK)) != 0U) {
+    TimeStampIRQ ();
+  }
+  if ((ev & ENET_EIR_WAKEUP_MASK) != 0U) {
+    ENET_ClearInterruptStatus (&Enet, ENET_EIR_WAKEUP_MASK);
+    ENET_EnableSleepMode (&Enet, false);
+    Callback (kENET_WakeUpEvent);
+  }
+  ev &= ENET_EIR_BABR_MASK | ENET_EIR_BABT_MASK | ENET_EIR_GRA_MASK | ENET_EIR_MII_MASK;
+  if (ev != 0U) {
+    ENET_ClearInterruptStatus (&Enet, ev);
+    Callback (kENET_ErrEvent);
+  }
+}
+
+/* Like the SDK handler, the 1588 timer handler does not clear compare channel flags */
+void ENET_1588_Timer_DriverIRQHandler (void) {
+  ENET_ModelSync ();
+  TimeStampIRQ ();
+}
@@ -0,0 +1,118 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      ENET behavioural model and host core for EMAC host tests
+ * -------------------------------------------------------------------------- */
+
+#ifndef ENET_MODEL_H_
+#define ENET_MODEL_H_
+
+/*
+  Host core (Host_Core.c)
+  -----------------------
+  Emulates a single Cortex-M core on the build host. Driver code, RTOS threads,
+  the wire (DMA) thread and interrupt handlers run one at a time under the host
+  CPU lock. The thread which calls Host_Init owns the CPU as thread mode and
+  gives it up in Host_Yield, Host_Sleep and blocking RTOS calls.
+
+  Two time bases are supported:
+  - real time (virt = 0): time is the host monotonic clock. ENET interrupts run
+    on a separate interrupt thread as soon as the CPU is given up, frames are
+    injected by the wire thread (ENET_ModelWireStart).
+  - virtual time (virt = 1): time only advances in Host_Sleep and
+    Host_Advance. Pending interrupts run on the calling thread when it enters
+    the model (ENET_ModelRx, Host_Advance, Host_Yield, Host_Sleep), so results
+    are reproducible.
+
+  ENET model (ENET_Model.c)
+  -------------------------
+  Models the ENET register interface, the receive and transmit descriptor DMA,
+  interrupt coalescing (RXIC/TXIC), the MIB counters (16-bit frame counters),
+  graceful transmit stop, the 1588 timer seconds counter and compare channels
+  and a PHY with 32 registers. Transmission completes as soon as the model sees
+  TDAR set. A received frame is written to the next receive descriptor when it
+  arrives; it is dropped and counted in IEEE_R_MACERR when the descriptor is
+  not empty or receive is not active (the receive FIFO is not modelled).
+  The model does not filter destination addresses.
+*/
+
+#include <stdint.h>
+
+#include "fsl_enet.h"
+
+/* Host core statistics */
+typedef struct {
+  uint64_t irq_cnt;                     /* ENET interrupt handler calls                 */
+  uint64_t irq_cycles;                  /* Host cycles spent in ENET interrupt handler  */
+  uint64_t irq_storm;                   /* Dispatch loops stopped with interrupt pending */
+  uint64_t thread_cycles;               /* Host cycles spent in RTOS threads (osThreadNew) */
+} HOST_STATS;
+
+/* ENET model statistics */
+typedef struct {
+  uint64_t rx_frames;                   /* Frames offered on the wire                   */
+  uint64_t rx_stored;                   /* Frames written to receive descriptors        */
+  uint64_t rx_drop;                     /* Frames dropped, no empty receive descriptor  */
+  uint64_t tx_frames;                   /* Frames transmitted                           */
+  uint64_t tx_bytes;                    /* Bytes transmitted                            */
+  uint64_t rx_irq;                      /* Receive frame interrupt events raised        */
+  uint64_t tx_irq;                      /* Transmit frame interrupt events raised       */
+  uint64_t tx_cycles;                   /* Host cycles spent in the transmit DMA model  */
+  uint64_t init;                        /* ENET_Init calls (peripheral re-initialization) */
+} ENET_MODEL_STATS;
+
+/* Frame generator: fill frame number seq, return frame length */
+typedef uint32_t (*ENET_ModelGen_t) (uint8_t *frame, uint32_t seq);
+
+/* Transmit hook: called for every transmitted frame */
+typedef void (*ENET_ModelTx_t) (const uint8_t *frame, uint32_t len);
+
+extern HOST_STATS       Host_Stats;
+extern ENET_MODEL_STATS ENET_ModelStats;
+
+/* Host core */
+extern void     Host_Init   (uint32_t virt);
+extern void     Host_Exit   (void);
+extern void     Host_Yield  (void);
+extern void     Host_Sleep  (uint32_t usec);
+extern void     Host_Advance (uint64_t ns);
+extern uint64_t Host_Time   (void);
+extern uint64_t Host_Cycles (void);
+
+/* ENET model */
+extern void     ENET_ModelReset     (void);
+extern uint32_t ENET_ModelRx        (const uint8_t *frame, uint32_t len);
+extern void     ENET_ModelTxHook    (ENET_ModelTx_t hook);
+extern void     ENET_ModelWireStart (uint32_t rate, ENET_ModelGen_t gen, uint32_t count);
+extern void     ENET_ModelWireStop  (void);
+extern void     ENET_ModelPhySet    (uint32_t reg, uint16_t val);
+
+/* Used by Host_Core.c */
+extern uint32_t ENET_ModelIrqPending (IRQn_Type irq);
+extern void     ENET_ModelSync       (void);
+extern uint64_t ENET_ModelDeadline   (void);
+extern void     Host_IrqWake         (void);
+extern void     Host_IrqRun          (void);
+extern void     Host_CpuLock         (void);
+extern void     Host_CpuUnlock       (void);
+
+#endif /* ENET_MODEL_H_ */
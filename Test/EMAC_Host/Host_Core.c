@@ -0,0 +1,591 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host core: CPU lock, interrupts, DWT and CMSIS-RTOS2 subset
+ * -------------------------------------------------------------------------- */
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ENET_Model.h"
+#include "cmsis_os2.h"
+
+/* Interrupt handler calls per dispatch before the dispatch gives up */
+#define IRQ_LOOP_MAX            64U
+
+#define NVIC_ENET               (1UL << 0)
+#define NVIC_1588               (1UL << 1)
+
+#define NSEC_PER_SEC            1000000000U
+
+/* RTOS thread */
+typedef struct {
+  pthread_t      tid;
+  osThreadFunc_t func;
+  void          *arg;
+  uint32_t       flags;                 /* Thread flags                          */
+  uint32_t       wait;                  /* Flags waited for, 0 = not waiting     */
+  uint32_t       ready;                 /* CPU ticket assigned by osThreadFlagsSet */
+  uint64_t       ticket;
+  uint32_t       term;                  /* Terminate requested                   */
+  uint64_t       t0;                    /* Host_Cycles when the thread got the CPU */
+} HOST_THREAD;
+
+uint32_t       SystemCoreClock = 600000000U;
+uint32_t       Host_PRIMASK;
+CoreDebug_Type Host_CoreDebug;
+HOST_STATS     Host_Stats;
+
+static DWT_Type Dwt;
+static uint32_t Dwt_Last;               /* CYCCNT value last published           */
+static uint32_t Dwt_Base;               /* CYCCNT minus host time in cycles      */
+
+static pthread_mutex_t Host_Mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  Host_Cond;       /* Broadcast on every CPU or flag change */
+
+/* CPU lock: FIFO tickets, the holder owns ticket Cpu_Serving */
+static uint64_t Cpu_Next;
+static uint64_t Cpu_Serving;
+static uint32_t Cpu_Irq;                /* CPU handed to the interrupt thread    */
+
+static uint32_t Virt;
+static uint64_t Virt_Time;
+static uint64_t Time0;
+
+static volatile uint32_t Nvic_En;
+static volatile uint32_t Irq_Req;
+static uint32_t          Isr_Active;
+
+static pthread_t Irq_Tid;
+static uint32_t  Irq_Run;
+
+static HOST_THREAD             Host_Main;
+static __thread HOST_THREAD   *Host_Self;
+
+/* Startup file vectors: the driver overrides these when it handles the interrupt itself */
+__WEAK void ENET_IRQHandler (void) {
+  ENET_DriverIRQHandler ();
+}
+
+__WEAK void ENET_1588_Timer_IRQHandler (void) {
+  ENET_1588_Timer_DriverIRQHandler ();
+}
+
+static uint64_t MonoTime (void) {
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * NSEC_PER_SEC) + (uint64_t)ts.tv_nsec);
+}
+
+static void AbsTime (struct timespec *ts, uint64_t ns) {
+  ns += MonoTime ();
+  ts->tv_sec  = (time_t)(ns / NSEC_PER_SEC);
+  ts->tv_nsec = (long)(ns % NSEC_PER_SEC);
+}
+
+/**
+  \fn          uint64_t Host_Time (void)
+  \brief       Get host time in ns (virtual time in virtual time mode).
+*/
+uint64_t Host_Time (void) {
+  return ((Virt != 0U) ? Virt_Time : (MonoTime () - Time0));
+}
+
+/**
+  \fn          uint64_t Host_Cycles (void)
+  \brief       Get CPU time of the calling host thread in SystemCoreClock cycles.
+  \note        Host execution time scaled to the core clock, not a Cortex-M7 cycle count.
+*/
+uint64_t Host_Cycles (void) {
+  struct timespec ts;
+  uint64_t ns;
+
+  clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts);
+  ns = ((uint64_t)ts.tv_sec * NSEC_PER_SEC) + (uint64_t)ts.tv_nsec;
+  return ((ns * (SystemCoreClock / 1000000U)) / 1000U);
+}
+
+/* DWT cycle counter runs at SystemCoreClock from host time */
+DWT_Type *Host_DWT (void) {
+  uint32_t cyc;
+
+  if (((Host_CoreDebug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk) != 0U) &&
+      ((Dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U)) {
+    cyc = (uint32_t)((Host_Time () * (SystemCoreClock / 1000000U)) / 1000U);
+    if (Dwt.CYCCNT != Dwt_Last) {
+      /* Counter written */
+      Dwt_Base = Dwt.CYCCNT - cyc;
+    }
+    Dwt.CYCCNT = Dwt_Base + cyc;
+    Dwt_Last   = Dwt.CYCCNT;
+  }
+  return (&Dwt);
+}
+
+uint32_t CLOCK_GetFreq (clock_name_t name) {
+  return ((name == kCLOCK_IpgClk) ? (SystemCoreClock / 4U) : SystemCoreClock);
+}
+
+static uint32_t NvicBit (IRQn_Type irq) {
+  return ((irq == ENET_IRQn) ? NVIC_ENET : NVIC_1588);
+}
+
+void NVIC_EnableIRQ (IRQn_Type irq) {
+  Nvic_En |= NvicBit (irq);
+  Irq_Req  = 1U;
+}
+
+void NVIC_DisableIRQ (IRQn_Type irq) {
+  Nvic_En &= ~NvicBit (irq);
+}
+
+uint32_t NVIC_GetEnableIRQ (IRQn_Type irq) {
+  return (((Nvic_En & NvicBit (irq)) != 0U) ? 1U : 0U);
+}
+
+void NVIC_SetPriority (IRQn_Type irq, uint32_t priority) {
+  (void)irq;
+  (void)priority;
+}
+
+/* Handler mode while an interrupt handler runs */
+uint32_t __get_IPSR (void) {
+  return ((Isr_Active != 0U) ? (16U + (uint32_t)ENET_IRQn) : 0U);
+}
+
+/* Interrupt can be taken: requested, enabled, not masked and no handler active */
+static uint32_t IrqReady (void) {
+
+  if ((Irq_Req == 0U) || (Host_PRIMASK != 0U) || (Isr_Active != 0U)) {
+    return (0U);
+  }
+  if (((Nvic_En & NVIC_ENET) != 0U) && (ENET_ModelIrqPending (ENET_IRQn) != 0U)) {
+    return (1U);
+  }
+  if (((Nvic_En & NVIC_1588) != 0U) && (ENET_ModelIrqPending (ENET_1588_Timer_IRQn) != 0U)) {
+    return (1U);
+  }
+  Irq_Req = 0U;
+  return (0U);
+}
+
+/* Run interrupt handlers until no enabled interrupt is pending (CPU held) */
+static void IrqDispatch (void) {
+  uint64_t t0;
+  uint32_t n;
+
+  Isr_Active = 1U;
+  for (n = 0U; n < IRQ_LOOP_MAX; n++) {
+    Irq_Req = 0U;
+    ENET_ModelSync ();
+    t0 = Host_Cycles ();
+    if (((Nvic_En & NVIC_ENET) != 0U) && (ENET_ModelIrqPending (ENET_IRQn) != 0U)) {
+      ENET_IRQHandler ();
+    } else if (((Nvic_En & NVIC_1588) != 0U) && (ENET_ModelIrqPending (ENET_1588_Timer_IRQn) != 0U)) {
+      ENET_1588_Timer_IRQHandler ();
+    } else {
+      break;
+    }
+    Host_Stats.irq_cycles += Host_Cycles () - t0;
+    Host_Stats.irq_cnt++;
+  }
+  if (n == IRQ_LOOP_MAX) {
+    Host_Stats.irq_storm++;
+  }
+  Irq_Req    = 0U;
+  Isr_Active = 0U;
+}
+
+/**
+  \fn          void Host_IrqWake (void)
+  \brief       Note that the ENET model requests an interrupt.
+*/
+void Host_IrqWake (void) {
+  Irq_Req = 1U;
+}
+
+/**
+  \fn          void Host_IrqRun (void)
+  \brief       Run pending interrupts on the calling thread (virtual time mode, CPU held).
+*/
+void Host_IrqRun (void) {
+  if ((Virt != 0U) && (IrqReady () != 0U)) {
+    IrqDispatch ();
+  }
+}
+
+/* Interrupt thread (real time mode): runs handlers when the CPU is handed over */
+static void *IrqThread (void *arg) {
+  (void)arg;
+
+  pthread_mutex_lock (&Host_Mutex);
+  for (;;) {
+    while ((Cpu_Irq == 0U) && (Irq_Run != 0U)) {
+      pthread_cond_wait (&Host_Cond, &Host_Mutex);
+    }
+    if (Cpu_Irq == 0U) {
+      break;
+    }
+    pthread_mutex_unlock (&Host_Mutex);
+    IrqDispatch ();
+    pthread_mutex_lock (&Host_Mutex);
+    Cpu_Irq = 0U;
+    Cpu_Serving++;
+    pthread_cond_broadcast (&Host_Cond);
+  }
+  pthread_mutex_unlock (&Host_Mutex);
+  return (NULL);
+}
+
+/* Wait for a CPU ticket (Host_Mutex locked) */
+static void CpuWait (uint64_t ticket) {
+  while (ticket != Cpu_Serving) {
+    pthread_cond_wait (&Host_Cond, &Host_Mutex);
+  }
+}
+
+/* Give up the CPU (Host_Mutex locked): a pending interrupt is handed the CPU first.
+   In virtual time mode the caller runs pending interrupts before it locks Host_Mutex. */
+static void CpuRelease (void) {
+
+  if ((Virt == 0U) && (IrqReady () != 0U)) {
+    Cpu_Irq = 1U;
+    pthread_cond_broadcast (&Host_Cond);
+    return;
+  }
+  Cpu_Serving++;
+  pthread_cond_broadcast (&Host_Cond);
+}
+
+/**
+  \fn          void Host_CpuLock (void)
+  \brief       Acquire the emulated core.
+*/
+void Host_CpuLock (void) {
+  pthread_mutex_lock (&Host_Mutex);
+  CpuWait (Cpu_Next++);
+  pthread_mutex_unlock (&Host_Mutex);
+}
+
+/**
+  \fn          void Host_CpuUnlock (void)
+  \brief       Release the emulated core.
+*/
+void Host_CpuUnlock (void) {
+  Host_IrqRun ();
+  pthread_mutex_lock (&Host_Mutex);
+  CpuRelease ();
+  pthread_mutex_unlock (&Host_Mutex);
+}
+
+/**
+  \fn          void Host_Init (uint32_t virt)
+  \brief       Reset the host core and ENET model, the calling thread gets the CPU.
+  \param[in]   virt  0 = real time, 1 = virtual time
+*/
+void Host_Init (uint32_t virt) {
+  pthread_condattr_t attr;
+
+  pthread_condattr_init (&attr);
+  pthread_condattr_setclock (&attr, CLOCK_MONOTONIC);
+  pthread_cond_init (&Host_Cond, &attr);
+  pthread_condattr_destroy (&attr);
+
+  Virt         = virt;
+  Virt_Time    = 0U;
+  Time0        = MonoTime ();
+  Nvic_En      = 0U;
+  Irq_Req      = 0U;
+  Isr_Active   = 0U;
+  Host_PRIMASK = 0U;
+  Cpu_Next     = 0U;
+  Cpu_Serving  = 0U;
+  Cpu_Irq      = 0U;
+  memset (&Host_Stats, 0, sizeof(Host_Stats));
+  memset (&Host_CoreDebug, 0, sizeof(Host_CoreDebug));
+  memset (&Dwt, 0, sizeof(Dwt));
+  Dwt_Last = 0U;
+  Dwt_Base = 0U;
+
+  memset (&Host_Main, 0, sizeof(Host_Main));
+  Host_Main.tid = pthread_self ();
+  Host_Self     = &Host_Main;
+
+  ENET_ModelReset ();
+  Host_CpuLock ();
+
+  if (virt == 0U) {
+    Irq_Run = 1U;
+    (void)pthread_create (&Irq_Tid, NULL, IrqThread, NULL);
+  }
+}
+
+/**
+  \fn          void Host_Exit (void)
+  \brief       Stop wire and interrupt threads and release the CPU.
+*/
+void Host_Exit (void) {
+
+  ENET_ModelWireStop ();
+  if (Virt == 0U) {
+    pthread_mutex_lock (&Host_Mutex);
+    Irq_Run = 0U;
+    pthread_cond_broadcast (&Host_Cond);
+    pthread_mutex_unlock (&Host_Mutex);
+    (void)pthread_join (Irq_Tid, NULL);
+  }
+  Nvic_En = 0U;
+  Host_CpuUnlock ();
+}
+
+/**
+  \fn          void Host_Yield (void)
+  \brief       Give up the CPU: pending interrupts and ready threads run first.
+*/
+void Host_Yield (void) {
+  Host_CpuUnlock ();
+  sched_yield ();
+  Host_CpuLock ();
+}
+
+/**
+  \fn          void Host_Advance (uint64_t ns)
+  \brief       Let time pass with the CPU held (thread busy or idle in a loop).
+  \note        Virtual time: model timers expire and interrupts run in order of their deadlines.
+*/
+void Host_Advance (uint64_t ns) {
+  struct timespec ts;
+  uint64_t end, dl;
+
+  if (Virt == 0U) {
+    ts.tv_sec  = (time_t)(ns / NSEC_PER_SEC);
+    ts.tv_nsec = (long)(ns % NSEC_PER_SEC);
+    Host_CpuUnlock ();
+    nanosleep (&ts, NULL);
+    Host_CpuLock ();
+    return;
+  }
+
+  end = Virt_Time + ns;
+  for (;;) {
+    Host_IrqRun ();
+    dl = ENET_ModelDeadline ();
+    if (dl > end) {
+      break;
+    }
+    Virt_Time = (dl > Virt_Time) ? dl : (Virt_Time + 1U);
+    ENET_ModelSync ();
+  }
+  Virt_Time = end;
+  ENET_ModelSync ();
+  Host_IrqRun ();
+}
+
+/**
+  \fn          void Host_Sleep (uint32_t usec)
+  \brief       Give up the CPU for a time.
+*/
+void Host_Sleep (uint32_t usec) {
+
+  if (Virt != 0U) {
+    Host_Advance ((uint64_t)usec * 1000U);
+    Host_Yield ();
+  } else {
+    Host_Advance ((uint64_t)usec * 1000U);
+  }
+}
+
+
+/* CMSIS-RTOS2 subset: threads are POSIX threads that run under the CPU lock */
+
+static void *ThreadEntry (void *arg) {
+  HOST_THREAD *t = (HOST_THREAD *)arg;
+
+  Host_Self = t;
+  pthread_mutex_lock (&Host_Mutex);
+  CpuWait (t->ticket);
+  pthread_mutex_unlock (&Host_Mutex);
+
+  t->t0 = Host_Cycles ();
+  if (t->term == 0U) {
+    t->func (t->arg);
+  }
+  Host_Stats.thread_cycles += Host_Cycles () - t->t0;
+  Host_CpuUnlock ();
+  free (t);
+  return (NULL);
+}
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+  HOST_THREAD *t;
+
+  (void)attr;
+
+  t = (HOST_THREAD *)calloc (1U, sizeof(HOST_THREAD));
+  if (t == NULL) {
+    return (NULL);
+  }
+  t->func = func;
+  t->arg  = argument;
+
+  /* Thread is ready: queue for the CPU behind the creating thread */
+  pthread_mutex_lock (&Host_Mutex);
+  t->ticket = Cpu_Next++;
+  pthread_mutex_unlock (&Host_Mutex);
+
+  if (pthread_create (&t->tid, NULL, ThreadEntry, t) != 0) {
+    free (t);
+    return (NULL);
+  }
+  (void)pthread_detach (t->tid);
+  return ((osThreadId_t)t);
+}
+
+osThreadId_t osThreadGetId (void) {
+  return ((osThreadId_t)Host_Self);
+}
+
+/* Thread exits when it gets the CPU next */
+osStatus_t osThreadTerminate (osThreadId_t thread_id) {
+  HOST_THREAD *t = (HOST_THREAD *)thread_id;
+
+  if ((t == NULL) || (t == Host_Self)) {
+    return (osError);
+  }
+  pthread_mutex_lock (&Host_Mutex);
+  t->term = 1U;
+  if ((t->wait != 0U) && (t->ready == 0U)) {
+    t->ticket = Cpu_Next++;
+    t->ready  = 1U;
+  }
+  pthread_cond_broadcast (&Host_Cond);
+  pthread_mutex_unlock (&Host_Mutex);
+  return (osOK);
+}
+
+uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
+  HOST_THREAD *t = (HOST_THREAD *)thread_id;
+  uint32_t ret;
+
+  if (t == NULL) {
+    return (osFlagsError);
+  }
+  pthread_mutex_lock (&Host_Mutex);
+  t->flags |= flags;
+  ret = t->flags;
+  if ((t->wait != 0U) && ((t->flags & t->wait) != 0U) && (t->ready == 0U)) {
+    /* Waiting thread becomes ready: queue for the CPU now, in order */
+    t->ticket = Cpu_Next++;
+    t->ready  = 1U;
+    pthread_cond_broadcast (&Host_Cond);
+  }
+  pthread_mutex_unlock (&Host_Mutex);
+  return (ret);
+}
+
+uint32_t osThreadFlagsClear (uint32_t flags) {
+  HOST_THREAD *t = Host_Self;
+  uint32_t ret;
+
+  pthread_mutex_lock (&Host_Mutex);
+  ret = t->flags;
+  t->flags &= ~flags;
+  pthread_mutex_unlock (&Host_Mutex);
+  return (ret);
+}
+
+/* Only osFlagsWaitAny; the timeout runs in host real time */
+uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout) {
+  HOST_THREAD *t = Host_Self;
+  struct timespec ts;
+  uint32_t ret;
+  int rc = 0;
+
+  (void)options;
+
+  Host_IrqRun ();
+  pthread_mutex_lock (&Host_Mutex);
+  if (((t->flags & flags) == 0U) && (timeout != 0U)) {
+    if (t != &Host_Main) {
+      Host_Stats.thread_cycles += Host_Cycles () - t->t0;
+    }
+    t->wait  = flags;
+    t->ready = 0U;
+    CpuRelease ();
+    if (timeout != osWaitForever) {
+      AbsTime (&ts, ((uint64_t)timeout * NSEC_PER_SEC) / osKernelGetTickFreq ());
+    }
+    while ((t->ready == 0U) && (rc == 0)) {
+      if (timeout == osWaitForever) {
+        pthread_cond_wait (&Host_Cond, &Host_Mutex);
+      } else {
+        rc = pthread_cond_timedwait (&Host_Cond, &Host_Mutex, &ts);
+      }
+    }
+    if (t->ready == 0U) {
+      t->ticket = Cpu_Next++;
+    }
+    t->wait  = 0U;
+    t->ready = 0U;
+    CpuWait (t->ticket);
+    t->t0 = Host_Cycles ();
+    if (t->term != 0U) {
+      CpuRelease ();
+      pthread_mutex_unlock (&Host_Mutex);
+      free (t);
+      pthread_exit (NULL);
+    }
+  }
+  ret = t->flags & flags;
+  t->flags &= ~ret;
+  pthread_mutex_unlock (&Host_Mutex);
+
+  return ((ret != 0U) ? ret : osFlagsErrorTimeout);
+}
+
+osStatus_t osDelay (uint32_t ticks) {
+  Host_Sleep (ticks * (1000000U / osKernelGetTickFreq ()));
+  return (osOK);
+}
+
+uint32_t osKernelGetTickFreq (void) {
+  return (1000U);
+}
+
+/* Kernel runs from Host_Init */
+osKernelState_t osKernelGetState (void) {
+  return (osKernelRunning);
+}
+
+int32_t osKernelLock (void) {
+  return (0);
+}
+
+int32_t osKernelRestoreLock (int32_t lock) {
+  return (lock);
+}
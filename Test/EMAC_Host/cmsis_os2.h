@@ -0,0 +1,88 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host replacement of cmsis_os2.h for EMAC host model
+ * -------------------------------------------------------------------------- */
+
+#ifndef CMSIS_OS2_H_
+#define CMSIS_OS2_H_
+
+/*
+  Subset of the CMSIS-RTOS2 API used by EMAC_iMXRT105x.c and the host tests,
+  implemented over POSIX threads in Host_Core.c. Threads run one at a time
+  under the host CPU lock, like threads on a single core.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void *osThreadId_t;
+typedef void (*osThreadFunc_t) (void *argument);
+
+typedef enum {
+  osPriorityNormal      = 24,
+  osPriorityAboveNormal = 32,
+  osPriorityHigh        = 40,
+  osPriorityRealtime    = 48
+} osPriority_t;
+
+typedef struct {
+  const char  *name;
+  uint32_t     attr_bits;
+  void        *cb_mem;
+  uint32_t     cb_size;
+  void        *stack_mem;
+  uint32_t     stack_size;
+  osPriority_t priority;
+  uint32_t     tz_module;
+  uint32_t     reserved;
+} osThreadAttr_t;
+
+typedef int32_t osStatus_t;
+
+typedef enum {
+  osKernelInactive      = 0,
+  osKernelReady         = 1,
+  osKernelRunning       = 2
+} osKernelState_t;
+
+#define osOK                      0
+#define osError                  -1
+
+#define osWaitForever             0xFFFFFFFFU
+#define osFlagsWaitAny            0x00000000U
+#define osFlagsError              0x80000000U
+#define osFlagsErrorTimeout       0xFFFFFFFEU
+
+extern osThreadId_t osThreadNew        (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+extern osThreadId_t osThreadGetId      (void);
+extern osStatus_t   osThreadTerminate  (osThreadId_t thread_id);
+extern uint32_t     osThreadFlagsSet   (osThreadId_t thread_id, uint32_t flags);
+extern uint32_t     osThreadFlagsClear (uint32_t flags);
+extern uint32_t     osThreadFlagsWait  (uint32_t flags, uint32_t options, uint32_t timeout);
+extern osStatus_t   osDelay            (uint32_t ticks);
+extern uint32_t     osKernelGetTickFreq(void);
+extern osKernelState_t osKernelGetState(void);
+extern int32_t      osKernelLock       (void);
+extern int32_t      osKernelRestoreLock(int32_t lock);
+
+#endif /* CMSIS_OS2_H_ */
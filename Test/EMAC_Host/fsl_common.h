@@ -0,0 +1,379 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host replacement of device header and fsl_common.h for EMAC host model
+ * -------------------------------------------------------------------------- */
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+/*
+  Provides the part of the MIMXRT1052 device header and of CMSIS-Core that
+  EMAC_iMXRT105x.c uses, for a little-endian 64-bit build host (GCC or Clang).
+
+  The ENET register block is a behavioural model (ENET_Model.c). Every access
+  through the ENET macro first lets the model catch up with register writes
+  done since the previous access, so that write side effects (ETHEREN, GTS,
+  TDAR, coalescing registers, write-1-to-clear EIR) take effect before the
+  driver reads the next register. DWT->CYCCNT counts host time scaled to
+  SystemCoreClock. Core interrupts are emulated by the host CPU lock: an
+  interrupt handler only runs while no other driver context holds the CPU.
+
+  Driver buffers and descriptors hold 32-bit addresses, link with -no-pie so
+  that static data is placed below 4 GB.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define __IO    volatile
+#define __I     volatile const
+#define __O     volatile
+
+#define __ALIGNED(x)                    __attribute__((aligned(x)))
+#define __WEAK                          __attribute__((weak))
+#define __STATIC_INLINE                 static inline
+#define __STATIC_FORCEINLINE            static inline __attribute__((always_inline))
+
+#define __CORTEX_M                      7U
+#define __DCACHE_PRESENT                1U
+
+#define AT_NONCACHEABLE_SECTION(var)                 var
+#define AT_NONCACHEABLE_SECTION_ALIGN(var, align)    __ALIGNED(align) var
+#define AT_QUICKACCESS_SECTION_DATA(var)             var
+#define AT_QUICKACCESS_SECTION_DATA_ALIGN(var, align) __ALIGNED(align) var
+#define SDK_SIZEALIGN(var, alignbytes) \
+  ((unsigned int)((var) + ((alignbytes) - 1U)) & (unsigned int)(~(unsigned int)((alignbytes) - 1U)))
+
+typedef int32_t status_t;
+enum {
+  kStatus_Success         = 0,
+  kStatus_Fail            = 1,
+  kStatus_InvalidArgument = 4,
+  kStatus_Timeout         = 5
+};
+
+/* Interrupt numbers */
+typedef enum {
+  ENET_IRQn            = 114,
+  ENET_1588_Timer_IRQn = 115
+} IRQn_Type;
+
+/* Clocks */
+typedef enum {
+  kCLOCK_CpuClk = 0,
+  kCLOCK_IpgClk = 2
+} clock_name_t;
+
+extern uint32_t SystemCoreClock;
+extern uint32_t CLOCK_GetFreq (clock_name_t name);
+
+/* NVIC (ENET_IRQn and ENET_1588_Timer_IRQn are modelled) */
+extern void     NVIC_EnableIRQ     (IRQn_Type irq);
+extern void     NVIC_DisableIRQ    (IRQn_Type irq);
+extern uint32_t NVIC_GetEnableIRQ  (IRQn_Type irq);
+extern void     NVIC_SetPriority   (IRQn_Type irq, uint32_t priority);
+
+/* Core registers and intrinsics */
+extern uint32_t Host_PRIMASK;
+
+static inline uint32_t __get_PRIMASK (void)         { return (Host_PRIMASK); }
+static inline void     __set_PRIMASK (uint32_t val) { Host_PRIMASK = val & 1U; }
+static inline void     __disable_irq (void)         { Host_PRIMASK = 1U; }
+static inline void     __enable_irq  (void)         { Host_PRIMASK = 0U; }
+
+extern uint32_t __get_IPSR (void);
+
+static inline void __DMB (void) { __atomic_thread_fence (__ATOMIC_SEQ_CST); }
+static inline void __DSB (void) { __atomic_thread_fence (__ATOMIC_SEQ_CST); }
+static inline void __ISB (void) { __atomic_signal_fence (__ATOMIC_SEQ_CST); }
+
+static inline uint32_t __CLZ (uint32_t value) {
+  return ((value == 0U) ? 32U : (uint32_t)__builtin_clz (value));
+}
+
+static inline uint32_t __REV (uint32_t value) {
+  return (__builtin_bswap32 (value));
+}
+
+static inline uint32_t __REV16 (uint32_t value) {
+  return (((value & 0x00FF00FFU) << 8) | ((value >> 8) & 0x00FF00FFU));
+}
+
+static inline uint32_t __UNALIGNED_UINT32_READ (const void *addr) {
+  uint32_t value;
+
+  memcpy (&value, addr, sizeof(value));
+  return (value);
+}
+
+/* Exclusive access: driver contexts are serialized by the host CPU lock */
+static inline uint32_t __LDREXW (volatile uint32_t *addr) {
+  return (*addr);
+}
+
+static inline uint32_t __STREXW (uint32_t value, volatile uint32_t *addr) {
+  *addr = value;
+  return (0U);
+}
+
+/* Cache maintenance (host memory is coherent) */
+static inline void SCB_CleanDCache_by_Addr (volatile void *addr, int32_t dsize) {
+  (void)addr;
+  (void)dsize;
+}
+
+static inline void SCB_InvalidateDCache_by_Addr (volatile void *addr, int32_t dsize) {
+  (void)addr;
+  (void)dsize;
+}
+
+/* Debug: DWT cycle counter */
+typedef struct {
+  __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+  __IO uint32_t CTRL;
+  __IO uint32_t CYCCNT;
+} DWT_Type;
+
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+
+extern CoreDebug_Type  Host_CoreDebug;
+extern DWT_Type       *Host_DWT (void);
+
+#define CoreDebug                       (&Host_CoreDebug)
+#define DWT                             (Host_DWT ())
+
+/* ENET register block (layout of MIMXRT1052 ENET_Type) */
+typedef struct {
+       uint32_t RESERVED_0[1];
+  __IO uint32_t EIR;
+  __IO uint32_t EIMR;
+       uint32_t RESERVED_1[1];
+  __IO uint32_t RDAR;
+  __IO uint32_t TDAR;
+       uint32_t RESERVED_2[3];
+  __IO uint32_t ECR;
+       uint32_t RESERVED_3[6];
+  __IO uint32_t MMFR;
+  __IO uint32_t MSCR;
+       uint32_t RESERVED_4[7];
+  __IO uint32_t MIBC;
+       uint32_t RESERVED_5[7];
+  __IO uint32_t RCR;
+       uint32_t RESERVED_6[15];
+  __IO uint32_t TCR;
+       uint32_t RESERVED_7[7];
+  __IO uint32_t PALR;
+  __IO uint32_t PAUR;
+  __IO uint32_t OPD;
+  __IO uint32_t TXIC[1];
+       uint32_t RESERVED_8[3];
+  __IO uint32_t RXIC[1];
+       uint32_t RESERVED_9[5];
+  __IO uint32_t IAUR;
+  __IO uint32_t IALR;
+  __IO uint32_t GAUR;
+  __IO uint32_t GALR;
+       uint32_t RESERVED_10[7];
+  __IO uint32_t TFWR;
+       uint32_t RESERVED_11[14];
+  __IO uint32_t RDSR;
+  __IO uint32_t TDSR;
+  __IO uint32_t MRBR;
+       uint32_t RESERVED_12[1];
+  __IO uint32_t RSFL;
+  __IO uint32_t RSEM;
+  __IO uint32_t RAEM;
+  __IO uint32_t RAFL;
+  __IO uint32_t TSEM;
+  __IO uint32_t TAEM;
+  __IO uint32_t TAFL;
+  __IO uint32_t TIPG;
+  __IO uint32_t FTRL;
+       uint32_t RESERVED_13[3];
+  __IO uint32_t TACC;
+  __IO uint32_t RACC;
+       uint32_t RESERVED_14[15];
+  __I  uint32_t RMON_T_PACKETS;
+  __I  uint32_t RMON_T_BC_PKT;
+  __I  uint32_t RMON_T_MC_PKT;
+  __I  uint32_t RMON_T_CRC_ALIGN;
+  __I  uint32_t RMON_T_UNDERSIZE;
+  __I  uint32_t RMON_T_OVERSIZE;
+  __I  uint32_t RMON_T_FRAG;
+  __I  uint32_t RMON_T_JAB;
+  __I  uint32_t RMON_T_COL;
+  __I  uint32_t RMON_T_P64;
+  __I  uint32_t RMON_T_P65TO127;
+  __I  uint32_t RMON_T_P128TO255;
+  __I  uint32_t RMON_T_P256TO511;
+  __I  uint32_t RMON_T_P512TO1023;
+  __I  uint32_t RMON_T_P1024TO2047;
+  __I  uint32_t RMON_T_P_GTE2048;
+  __I  uint32_t RMON_T_OCTETS;
+       uint32_t IEEE_T_DROP;
+  __I  uint32_t IEEE_T_FRAME_OK;
+  __I  uint32_t IEEE_T_1COL;
+  __I  uint32_t IEEE_T_MCOL;
+  __I  uint32_t IEEE_T_DEF;
+  __I  uint32_t IEEE_T_LCOL;
+  __I  uint32_t IEEE_T_EXCOL;
+  __I  uint32_t IEEE_T_MACERR;
+  __I  uint32_t IEEE_T_CSERR;
+  __I  uint32_t IEEE_T_SQE;
+  __I  uint32_t IEEE_T_FDXFC;
+  __I  uint32_t IEEE_T_OCTETS_OK;
+       uint32_t RESERVED_15[3];
+  __I  uint32_t RMON_R_PACKETS;
+  __I  uint32_t RMON_R_BC_PKT;
+  __I  uint32_t RMON_R_MC_PKT;
+  __I  uint32_t RMON_R_CRC_ALIGN;
+  __I  uint32_t RMON_R_UNDERSIZE;
+  __I  uint32_t RMON_R_OVERSIZE;
+  __I  uint32_t RMON_R_FRAG;
+  __I  uint32_t RMON_R_JAB;
+       uint32_t RMON_R_RESVD_0;
+  __I  uint32_t RMON_R_P64;
+  __I  uint32_t RMON_R_P65TO127;
+  __I  uint32_t RMON_R_P128TO255;
+  __I  uint32_t RMON_R_P256TO511;
+  __I  uint32_t RMON_R_P512TO1023;
+  __I  uint32_t RMON_R_P1024TO2047;
+  __I  uint32_t RMON_R_P_GTE2048;
+  __I  uint32_t RMON_R_OCTETS;
+  __I  uint32_t IEEE_R_DROP;
+  __I  uint32_t IEEE_R_FRAME_OK;
+  __I  uint32_t IEEE_R_CRC;
+  __I  uint32_t IEEE_R_ALIGN;
+  __I  uint32_t IEEE_R_MACERR;
+  __I  uint32_t IEEE_R_FDXFC;
+  __I  uint32_t IEEE_R_OCTETS_OK;
+       uint32_t RESERVED_16[71];
+  __IO uint32_t ATCR;
+  __IO uint32_t ATVR;
+  __IO uint32_t ATOFF;
+  __IO uint32_t ATPER;
+  __IO uint32_t ATCOR;
+  __IO uint32_t ATINC;
+  __I  uint32_t ATSTMP;
+       uint32_t RESERVED_17[122];
+  __IO uint32_t TGSR;
+  struct {
+    __IO uint32_t TCSR;
+    __IO uint32_t TCCR;
+  } CHANNEL[4];
+} ENET_Type;
+
+extern ENET_Type *ENET_ModelAccess (void);
+
+#define ENET                            (ENET_ModelAccess ())
+
+#define ENET_EIR_BABR_MASK              (0x40000000U)
+#define ENET_EIR_BABT_MASK              (0x20000000U)
+#define ENET_EIR_GRA_MASK               (0x10000000U)
+#define ENET_EIR_TXF_MASK               (0x08000000U)
+#define ENET_EIR_TXB_MASK               (0x04000000U)
+#define ENET_EIR_RXF_MASK               (0x02000000U)
+#define ENET_EIR_RXB_MASK               (0x01000000U)
+#define ENET_EIR_MII_MASK               (0x00800000U)
+#define ENET_EIR_WAKEUP_MASK            (0x00020000U)
+#define ENET_EIR_TS_AVAIL_MASK          (0x00010000U)
+#define ENET_EIR_TS_TIMER_MASK          (0x00008000U)
+
+#define ENET_RDAR_RDAR_MASK             (0x01000000U)
+#define ENET_TDAR_TDAR_MASK             (0x01000000U)
+
+#define ENET_ECR_RESET_MASK             (0x00000001U)
+#define ENET_ECR_ETHEREN_MASK           (0x00000002U)
+#define ENET_ECR_MAGICEN_MASK           (0x00000004U)
+#define ENET_ECR_SLEEP_MASK             (0x00000008U)
+#define ENET_ECR_EN1588_MASK            (0x00000010U)
+#define ENET_ECR_DBSWP_MASK             (0x00000100U)
+
+#define ENET_MMFR_DATA_MASK             (0x0000FFFFU)
+#define ENET_MMFR_RA_SHIFT              (18U)
+#define ENET_MMFR_PA_SHIFT              (23U)
+#define ENET_MMFR_OP_SHIFT              (28U)
+
+#define ENET_MIBC_MIB_CLEAR_MASK        (0x20000000U)
+#define ENET_MIBC_MIB_IDLE_MASK         (0x40000000U)
+#define ENET_MIBC_MIB_DIS_MASK          (0x80000000U)
+
+#define ENET_RCR_LOOP_MASK              (0x00000001U)
+#define ENET_RCR_DRT_MASK               (0x00000002U)
+#define ENET_RCR_MII_MODE_MASK          (0x00000004U)
+#define ENET_RCR_PROM_MASK              (0x00000008U)
+#define ENET_RCR_BC_REJ_MASK            (0x00000010U)
+#define ENET_RCR_FCE_MASK               (0x00000020U)
+#define ENET_RCR_RMII_MODE_MASK         (0x00000100U)
+#define ENET_RCR_RMII_10T_MASK          (0x00000200U)
+#define ENET_RCR_PADEN_MASK             (0x00001000U)
+#define ENET_RCR_PAUFWD_MASK            (0x00002000U)
+#define ENET_RCR_CRCFWD_MASK            (0x00004000U)
+#define ENET_RCR_CFEN_MASK              (0x00008000U)
+#define ENET_RCR_MAX_FL_SHIFT           (16U)
+#define ENET_RCR_MAX_FL_MASK            (0x3FFF0000U)
+#define ENET_RCR_MAX_FL(x)              (((uint32_t)(x) << ENET_RCR_MAX_FL_SHIFT) & ENET_RCR_MAX_FL_MASK)
+
+#define ENET_TCR_GTS_MASK               (0x00000001U)
+#define ENET_TCR_FDEN_MASK              (0x00000004U)
+#define ENET_TCR_TFC_PAUSE_MASK         (0x00000008U)
+#define ENET_TCR_RFC_PAUSE_MASK         (0x00000010U)
+
+#define ENET_OPD_PAUSE_DUR(x)           ((uint32_t)(x) & 0x0000FFFFU)
+
+#define ENET_TXIC_ICTT(x)               ((uint32_t)(x) & 0x0000FFFFU)
+#define ENET_TXIC_ICFT(x)               (((uint32_t)(x) << 20) & 0x0FF00000U)
+#define ENET_TXIC_ICCS_MASK             (0x40000000U)
+#define ENET_TXIC_ICEN_MASK             (0x80000000U)
+#define ENET_RXIC_ICTT(x)               ((uint32_t)(x) & 0x0000FFFFU)
+#define ENET_RXIC_ICFT(x)               (((uint32_t)(x) << 20) & 0x0FF00000U)
+#define ENET_RXIC_ICCS_MASK             (0x40000000U)
+#define ENET_RXIC_ICEN_MASK             (0x80000000U)
+
+#define ENET_RSFL_RX_SECTION_FULL(x)    ((uint32_t)(x) & 0x000000FFU)
+#define ENET_RSEM_RX_SECTION_EMPTY_MASK (0x000000FFU)
+#define ENET_RSEM_RX_SECTION_EMPTY(x)   ((uint32_t)(x) & ENET_RSEM_RX_SECTION_EMPTY_MASK)
+
+#define ENET_ATCR_EN_MASK               (0x00000001U)
+#define ENET_ATCR_CAPTURE_MASK          (0x00000800U)
+#define ENET_ATINC_INC(x)               ((uint32_t)(x) & 0x0000007FU)
+#define ENET_ATINC_INC_CORR(x)          (((uint32_t)(x) << 8) & 0x00007F00U)
+#define ENET_ATCOR_COR_MASK             (0x7FFFFFFFU)
+#define ENET_ATCOR_COR(x)               ((uint32_t)(x) & ENET_ATCOR_COR_MASK)
+
+#define ENET_TCSR_TDRE_MASK             (0x00000001U)
+#define ENET_TCSR_TMODE_MASK            (0x0000003CU)
+#define ENET_TCSR_TMODE(x)              (((uint32_t)(x) << 2) & ENET_TCSR_TMODE_MASK)
+#define ENET_TCSR_TIE_MASK              (0x00000040U)
+#define ENET_TCSR_TF_MASK               (0x00000080U)
+
+#define FSL_FEATURE_ENET_QUEUE                      1
+#define FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE     1
+
+#endif /* FSL_COMMON_H_ */
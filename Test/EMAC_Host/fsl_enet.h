@@ -0,0 +1,329 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates).
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * $Date:        16. October 2026
+ * $Revision:    V1.0
+ *
+ * Project:      Host replacement of fsl_enet.h for EMAC host model
+ * -------------------------------------------------------------------------- */
+
+#ifndef FSL_ENET_H_
+#define FSL_ENET_H_
+
+/*
+  Declares the subset of the MCUXpresso SDK ENET driver API that
+  EMAC_iMXRT105x.c uses, with the SDK type layouts for a single ring.
+  The functions are implemented against the register model in ENET_Model.c.
+*/
+
+#include "fsl_common.h"
+
+/* Buffer descriptor control flags */
+#define ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK           0x8000U
+#define ENET_BUFFDESCRIPTOR_RX_SOFTOWNER1_MASK      0x4000U
+#define ENET_BUFFDESCRIPTOR_RX_WRAP_MASK            0x2000U
+#define ENET_BUFFDESCRIPTOR_RX_SOFTOWNER2_Mask      0x1000U
+#define ENET_BUFFDESCRIPTOR_RX_LAST_MASK            0x0800U
+#define ENET_BUFFDESCRIPTOR_RX_MISS_MASK            0x0100U
+#define ENET_BUFFDESCRIPTOR_RX_BROADCAST_MASK       0x0080U
+#define ENET_BUFFDESCRIPTOR_RX_MULTICAST_MASK       0x0040U
+#define ENET_BUFFDESCRIPTOR_RX_LENVLIOLATE_MASK     0x0020U
+#define ENET_BUFFDESCRIPTOR_RX_NOOCTET_MASK         0x0010U
+#define ENET_BUFFDESCRIPTOR_RX_CRC_MASK             0x0004U
+#define ENET_BUFFDESCRIPTOR_RX_OVERRUN_MASK         0x0002U
+#define ENET_BUFFDESCRIPTOR_RX_TRUNC_MASK           0x0001U
+
+#define ENET_BUFFDESCRIPTOR_TX_READY_MASK           0x8000U
+#define ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK     0x4000U
+#define ENET_BUFFDESCRIPTOR_TX_WRAP_MASK            0x2000U
+#define ENET_BUFFDESCRIPTOR_TX_SOFTOWENER2_MASK     0x1000U
+#define ENET_BUFFDESCRIPTOR_TX_LAST_MASK            0x0800U
+#define ENET_BUFFDESCRIPTOR_TX_TRANMITCRC_MASK      0x0400U
+
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+#define ENET_BUFFDESCRIPTOR_RX_IPV4_MASK            0x0001U
+#define ENET_BUFFDESCRIPTOR_RX_IPV6_MASK            0x0002U
+#define ENET_BUFFDESCRIPTOR_RX_VLAN_MASK            0x0004U
+#define ENET_BUFFDESCRIPTOR_RX_PROTOCOLCHECKSUM_MASK 0x0010U
+#define ENET_BUFFDESCRIPTOR_RX_IPHEADCHECKSUM_MASK  0x0020U
+#define ENET_BUFFDESCRIPTOR_RX_INTERRUPT_MASK       0x0080U
+#define ENET_BUFFDESCRIPTOR_RX_UNICAST_MASK         0x0100U
+#define ENET_BUFFDESCRIPTOR_RX_COLLISION_MASK       0x0200U
+#define ENET_BUFFDESCRIPTOR_RX_PHYERR_MASK          0x0400U
+#define ENET_BUFFDESCRIPTOR_RX_MACERR_MASK          0x8000U
+#define ENET_BUFFDESCRIPTOR_TX_ERR_MASK             0x8000U
+#define ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK       0x4000U
+#define ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK       0x2000U
+#define ENET_BUFFDESCRIPTOR_TX_PROTOCHECKSUM_MASK   0x1000U
+#define ENET_BUFFDESCRIPTOR_TX_IPCHECKSUM_MASK      0x0800U
+#endif
+
+#define ENET_BUFFDESCRIPTOR_RX_ERR_MASK \
+  (ENET_BUFFDESCRIPTOR_RX_TRUNC_MASK | ENET_BUFFDESCRIPTOR_RX_OVERRUN_MASK | \
+   ENET_BUFFDESCRIPTOR_RX_LENVLIOLATE_MASK | ENET_BUFFDESCRIPTOR_RX_NOOCTET_MASK | ENET_BUFFDESCRIPTOR_RX_CRC_MASK)
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+#define ENET_BUFFDESCRIPTOR_RX_EXT_ERR_MASK \
+  (ENET_BUFFDESCRIPTOR_RX_MACERR_MASK | ENET_BUFFDESCRIPTOR_RX_PHYERR_MASK | ENET_BUFFDESCRIPTOR_RX_COLLISION_MASK)
+#endif
+
+#define ENET_FRAME_MAX_FRAMELEN         1518U
+#define ENET_FCS_LEN                    4U
+#define ENET_BUFF_ALIGNMENT             64U
+
+/* Status codes */
+enum {
+  kStatus_ENET_InitMemoryFail = 4000,
+  kStatus_ENET_RxFrameError,
+  kStatus_ENET_RxFrameFail,
+  kStatus_ENET_RxFrameEmpty,
+  kStatus_ENET_RxFrameDrop,
+  kStatus_ENET_TxFrameOverLen,
+  kStatus_ENET_TxFrameBusy,
+  kStatus_ENET_TxFrameFail
+};
+
+typedef enum { kENET_MiiMode = 0U, kENET_RmiiMode = 1U } enet_mii_mode_t;
+typedef enum { kENET_MiiSpeed10M = 0U, kENET_MiiSpeed100M = 1U } enet_mii_speed_t;
+typedef enum { kENET_MiiHalfDuplex = 0U, kENET_MiiFullDuplex = 1U } enet_mii_duplex_t;
+typedef enum { kENET_MiiWriteNoCompliant = 0U, kENET_MiiWriteValidFrame = 1U } enet_mii_write_t;
+typedef enum { kENET_MiiReadValidFrame = 2U, kENET_MiiReadNoCompliant = 3U } enet_mii_read_t;
+
+typedef enum {
+  kENET_ControlFlowControlEnable       = 0x0001U,
+  kENET_ControlRxPayloadCheckEnable    = 0x0002U,
+  kENET_ControlRxPadRemoveEnable       = 0x0004U,
+  kENET_ControlRxBroadCastRejectEnable = 0x0008U,
+  kENET_ControlMacAddrInsert           = 0x0010U,
+  kENET_ControlStoreAndFwdDisable      = 0x0020U,
+  kENET_ControlSMIPreambleDisable      = 0x0040U,
+  kENET_ControlPromiscuousEnable       = 0x0080U,
+  kENET_ControlMIILoopEnable           = 0x0100U,
+  kENET_ControlVLANTagEnable           = 0x0200U
+} enet_special_control_flag_t;
+
+typedef enum {
+  kENET_BabrInterrupt          = ENET_EIR_BABR_MASK,
+  kENET_BabtInterrupt          = ENET_EIR_BABT_MASK,
+  kENET_GraceStopInterrupt     = ENET_EIR_GRA_MASK,
+  kENET_TxFrameInterrupt       = ENET_EIR_TXF_MASK,
+  kENET_TxBufferInterrupt      = ENET_EIR_TXB_MASK,
+  kENET_RxFrameInterrupt       = ENET_EIR_RXF_MASK,
+  kENET_RxBufferInterrupt      = ENET_EIR_RXB_MASK,
+  kENET_MiiInterrupt           = ENET_EIR_MII_MASK,
+  kENET_WakeupInterrupt        = ENET_EIR_WAKEUP_MASK,
+  kENET_TsAvailInterrupt       = ENET_EIR_TS_AVAIL_MASK,
+  kENET_TsTimerInterrupt       = ENET_EIR_TS_TIMER_MASK
+} enet_interrupt_enable_t;
+
+typedef enum {
+  kENET_RxEvent,
+  kENET_TxEvent,
+  kENET_ErrEvent,
+  kENET_WakeUpEvent,
+  kENET_TimeStampEvent,
+  kENET_TimeStampAvailEvent
+} enet_event_t;
+
+typedef enum {
+  kENET_RxAccelPadRemoveEnabled  = 0x01U,
+  kENET_RxAccelIpCheckEnabled    = 0x02U,
+  kENET_RxAccelProtoCheckEnabled = 0x04U,
+  kENET_RxAccelMacCheckEnabled   = 0x40U,
+  kENET_RxAccelisShift16Enabled  = 0x80U
+} enet_rx_accelerator_t;
+
+typedef enum {
+  kENET_TxAccelIsShift16Enabled  = 0x01U,
+  kENET_TxAccelIpCheckEnabled    = 0x08U,
+  kENET_TxAccelProtoCheckEnabled = 0x10U
+} enet_tx_accelerator_t;
+
+typedef enum {
+  kENET_PtpTimerChannel1 = 0U,
+  kENET_PtpTimerChannel2,
+  kENET_PtpTimerChannel3,
+  kENET_PtpTimerChannel4
+} enet_ptp_timer_channel_t;
+
+typedef enum {
+  kENET_PtpChannelDisable     = 0U,
+  kENET_PtpChannelSoftCompare = 0x4U
+} enet_ptp_timer_channel_mode_t;
+
+/* Buffer descriptors */
+typedef struct _enet_rx_bd_struct {
+  uint16_t length;
+  uint16_t control;
+  uint32_t buffer;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+  uint16_t controlExtend0;
+  uint16_t controlExtend1;
+  uint16_t payloadCheckSum;
+  uint8_t  headerLength;
+  uint8_t  protocolTyte;
+  uint16_t reserved0;
+  uint16_t controlExtend2;
+  uint32_t timestamp;
+  uint16_t reserved1;
+  uint16_t reserved2;
+  uint16_t reserved3;
+  uint16_t reserved4;
+#endif
+} enet_rx_bd_struct_t;
+
+typedef struct _enet_tx_bd_struct {
+  uint16_t length;
+  uint16_t control;
+  uint32_t buffer;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+  uint16_t controlExtend0;
+  uint16_t controlExtend1;
+  uint16_t reserved0;
+  uint16_t reserved1;
+  uint16_t reserved2;
+  uint16_t controlExtend2;
+  uint32_t timestamp;
+  uint16_t reserved3;
+  uint16_t reserved4;
+  uint16_t reserved5;
+  uint16_t reserved6;
+#endif
+} enet_tx_bd_struct_t;
+
+typedef struct _enet_ptp_time {
+  uint64_t second;
+  uint32_t nanosecond;
+} enet_ptp_time_t;
+
+typedef struct _enet_frame_info {
+  void           *context;
+  bool            isTsAvail;
+  enet_ptp_time_t timeStamp;
+} enet_frame_info_t;
+
+typedef struct _enet_buffer_config {
+  uint16_t rxBdNumber;
+  uint16_t txBdNumber;
+  uint16_t rxBuffSizeAlign;
+  uint16_t txBuffSizeAlign;
+  volatile enet_rx_bd_struct_t *rxBdStartAddrAlign;
+  volatile enet_tx_bd_struct_t *txBdStartAddrAlign;
+  uint8_t *rxBufferAlign;
+  uint8_t *txBufferAlign;
+  bool     rxMaintainEnable;
+  bool     txMaintainEnable;
+  enet_frame_info_t *txFrameInfo;
+} enet_buffer_config_t;
+
+typedef struct _enet_intcoalesce_config {
+  uint8_t  txCoalesceFrameCount[1];
+  uint16_t txCoalesceTimeCount[1];
+  uint8_t  rxCoalesceFrameCount[1];
+  uint16_t rxCoalesceTimeCount[1];
+} enet_intcoalesce_config_t;
+
+typedef struct _enet_ptp_config {
+  enet_ptp_timer_channel_t channel;
+  uint32_t ptp1588ClockSrc_Hz;
+} enet_ptp_config_t;
+
+typedef struct _enet_handle enet_handle_t;
+
+typedef void (*enet_callback_t)(ENET_Type *base, enet_handle_t *handle, enet_event_t event,
+                                enet_frame_info_t *frameInfo, void *userData);
+
+typedef struct _enet_config {
+  uint32_t          macSpecialConfig;
+  uint32_t          interrupt;
+  uint16_t          rxMaxFrameLen;
+  enet_mii_mode_t   miiMode;
+  enet_mii_speed_t  miiSpeed;
+  enet_mii_duplex_t miiDuplex;
+  uint8_t           rxAccelerConfig;
+  uint8_t           txAccelerConfig;
+  uint16_t          pauseDuration;
+  uint8_t           rxFifoEmptyThreshold;
+  uint8_t           rxFifoFullThreshold;
+  uint8_t           txFifoWatermark;
+  enet_intcoalesce_config_t *intCoalesceCfg;
+  uint8_t           ringNum;
+  enet_callback_t   callback;
+  void             *userData;
+} enet_config_t;
+
+typedef struct _enet_rx_bd_ring {
+  volatile enet_rx_bd_struct_t *rxBdBase;
+  uint16_t rxGenIdx;
+  uint16_t rxRingLen;
+} enet_rx_bd_ring_t;
+
+typedef struct _enet_tx_bd_ring {
+  volatile enet_tx_bd_struct_t *txBdBase;
+  uint16_t          txGenIdx;
+  uint16_t          txConsumIdx;
+  volatile uint16_t txDescUsed;
+  uint16_t          txRingLen;
+} enet_tx_bd_ring_t;
+
+struct _enet_handle {
+  enet_rx_bd_ring_t rxBdRing[1];
+  enet_tx_bd_ring_t txBdRing[1];
+  uint16_t          rxBuffSizeAlign[1];
+  uint16_t          txBuffSizeAlign[1];
+  enet_callback_t   callback;
+  void             *userData;
+};
+
+/* Initialization */
+extern status_t ENET_Init   (ENET_Type *base, enet_handle_t *handle, const enet_config_t *config,
+                             const enet_buffer_config_t *bufferConfig, uint8_t *macAddr, uint32_t srcClock_Hz);
+extern void     ENET_Deinit (ENET_Type *base);
+
+/* MAC address and filter */
+extern void ENET_SetMacAddr        (ENET_Type *base, uint8_t *macAddr);
+extern void ENET_GetMacAddr        (ENET_Type *base, uint8_t *macAddr);
+extern void ENET_AddMulticastGroup (ENET_Type *base, uint8_t *address);
+
+/* Receive, sleep and interrupts */
+extern void     ENET_ActiveRead           (ENET_Type *base);
+extern void     ENET_EnableSleepMode      (ENET_Type *base, bool enable);
+extern uint32_t ENET_GetInterruptStatus   (ENET_Type *base);
+extern void     ENET_ClearInterruptStatus (ENET_Type *base, uint32_t mask);
+
+/* MDIO */
+extern void     ENET_StartSMIRead  (ENET_Type *base, uint32_t phyAddr, uint32_t phyReg, enet_mii_read_t operation);
+extern void     ENET_StartSMIWrite (ENET_Type *base, uint32_t phyAddr, uint32_t phyReg, enet_mii_write_t operation,
+                                    uint32_t data);
+extern uint32_t ENET_ReadSMIData   (ENET_Type *base);
+
+/* IEEE 1588 timer */
+extern void ENET_Ptp1588Configure          (ENET_Type *base, enet_handle_t *handle, enet_ptp_config_t *ptpConfig);
+extern void ENET_Ptp1588GetTimer           (ENET_Type *base, enet_handle_t *handle, enet_ptp_time_t *ptpTime);
+extern void ENET_Ptp1588SetTimer           (ENET_Type *base, enet_handle_t *handle, enet_ptp_time_t *ptpTime);
+extern void ENET_Ptp1588SetChannelMode     (ENET_Type *base, enet_ptp_timer_channel_t channel,
+                                            enet_ptp_timer_channel_mode_t mode, bool intEnable);
+extern void ENET_Ptp1588SetChannelCmpValue (ENET_Type *base, enet_ptp_timer_channel_t channel, uint32_t cmpValue);
+extern void ENET_Ptp1588ClearChannelStatus (ENET_Type *base, enet_ptp_timer_channel_t channel);
+extern bool ENET_Ptp1588GetChannelStatus   (ENET_Type *base, enet_ptp_timer_channel_t channel);
+
+/* Interrupt handlers */
+extern void ENET_DriverIRQHandler            (void);
+extern void ENET_1588_Timer_DriverIRQHandler (void);
+
+#endif /* FSL_ENET_H_ */